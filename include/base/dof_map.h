@@ -232,6 +232,14 @@ public:
    * Distrubute dofs on the current mesh.  Also builds the send list for
    * processor \p proc_id, which defaults to 0 for ease of use in serial
    * applications.
+   *
+   * Each processor numbers its dofs in a single pass over its local
+   * nodes and elements, starting from 0, and then shifts them by its
+   * offset once the offsets are known.  With
+   * set_incremental_dof_numbering(), dofs which survive a mesh change
+   * keep their order and only new ones are numbered.  The send list
+   * and the sparsity pattern are rebuilt for the whole mesh either
+   * way.
    */
   void distribute_dofs (MeshBase &);
 
@@ -478,27 +486,38 @@ public:
   { return cast_int<unsigned int>(_variables.size()); }
 
   /**
-   * \returns \p true if the variables are capable of being stored in a blocked
-   * form.  Presently, this means that there can only be one variable group,
-   * and that the group has more than one variable.
+   * \returns \p true if the degrees of freedom are capable of being
+   * stored in a blocked form, see \p block_size().
    */
   bool has_blocked_representation() const
   {
 #ifdef LIBMESH_ENABLE_BLOCKED_STORAGE
-    return ((this->n_variable_groups() == 1) && (this->n_variables() > 1));
+    return (this->block_size() > 1);
 #else
     return false;
 #endif
   }
 
   /**
-   * \returns The block size, if the variables are amenable to block storage.
-   * Otherwise 1.
+   * \returns The block size, if the degrees of freedom are amenable to
+   * block storage.  Otherwise 1.
+   *
+   * This is the case if every node and element with degrees of
+   * freedom has the same number of them, numbered contiguously and
+   * starting at a multiple of that number, and there are no SCALAR
+   * variables.  Then every row and column of a matrix belongs to a
+   * dense block of that size.  The default variable-major numbering
+   * satisfies this e.g. when all the variables are in a single
+   * variable group, the node-major numbering whenever all the nodes
+   * carry the same degrees of freedom.
+   *
+   * The blocks are only looked for when libMesh is configured with
+   * --enable-blocked-storage; otherwise this is always 1.
    */
   unsigned int block_size() const
   {
 #ifdef LIBMESH_ENABLE_BLOCKED_STORAGE
-    return (this->has_blocked_representation() ? this->n_variables() : 1);
+    return _block_size;
 #else
     return 1;
 #endif
@@ -662,6 +681,30 @@ public:
    */
   void set_implicit_neighbor_dofs(bool implicit_neighbor_dofs);
 
+  /**
+   * Sets the order in which the degrees of freedom on each processor
+   * are numbered, for better cache reuse in matrix-vector products
+   * and preconditioners.  "rcm" uses a reverse Cuthill-McKee ordering
+   * of the nodes and elements, which reduces the bandwidth of the
+   * local matrix, and "hilbert" follows a Hilbert curve through them.
+   * The default, an empty string, numbers them in element iteration
+   * order.  This overrides the --dof_ordering commandline option.
+   */
+  void set_dof_ordering(const std::string & dof_ordering);
+
+  /**
+   * Makes distribute_dofs() keep the numbering of the dofs which were
+   * already on this processor, in the same order, and number the dofs
+   * of new nodes and elements after them; the gaps left by removed
+   * dofs are then closed up.  Unchanged parts of the mesh then keep
+   * their relative numbering through refinement and coarsening.
+   *
+   * This needs AMR support for the previous numbering, and is ignored
+   * the first time dofs are distributed, with a dof ordering, and with
+   * the --node_major_dofs commandline option.  It is off by default.
+   */
+  void set_incremental_dof_numbering(bool incremental);
+
   /**
    * Tells other library functions whether or not this problem
    * includes coupling between dofs in neighboring cells, as can
@@ -720,7 +763,9 @@ public:
   /**
    * Rebuilds the raw degree of freedom and DofObject constraints.
    * A time is specified for use in building time-dependent Dirichlet
-   * constraints.
+   * constraints.  With set_cache_dirichlet_values(), the values of
+   * Dirichlet boundaries whose functions are not time-dependent are
+   * only projected once.
    */
   void create_dof_constraints (const MeshBase &, Real time=0);
 
@@ -760,6 +805,54 @@ public:
    */
   void process_constraints (MeshBase &);
 
+#ifdef LIBMESH_ENABLE_DIRICHLET
+  /**
+   * Recomputes the values of the processed primal constraints which
+   * depend on time-dependent Dirichlet boundaries, at time \p time,
+   * without rebuilding any constraint rows.  Only the elements on
+   * those boundaries are projected again, so this is much cheaper
+   * than create_dof_constraints() and process_constraints() when
+   * the Dirichlet values change every time step but the mesh and the
+   * constraint rows do not.
+   *
+   * Updates have to be allowed with allow_dirichlet_value_updates()
+   * before the constraints are created, and the constraints must
+   * have been processed since.  Adjoint constraint values are not
+   * updated.
+   */
+  void update_dirichlet_constraint_values (const MeshBase &, Real time=0);
+
+  /**
+   * Makes create_dof_constraints() and process_constraints() keep
+   * track of which constraint values depend on time-dependent
+   * Dirichlet boundaries, so that update_dirichlet_constraint_values()
+   * can be used.  That tracking costs extra work and communication
+   * every time the constraints are built, so it is off by default.
+   * Changing this setting forgets any dependencies found so far.
+   */
+  void allow_dirichlet_value_updates (bool allow);
+  bool allow_dirichlet_value_updates () const
+  { return _allow_dirichlet_value_updates; }
+
+  /**
+   * Makes create_dof_constraints() keep the values it projects for
+   * Dirichlet boundaries whose functions are not time-dependent, and
+   * reuse them until the dofs are next distributed.  Nothing tells
+   * the DofMap when nodes move or when such a function changes, for
+   * instance when a ParsedFunction is given a new expression, so
+   * clear_dirichlet_values() has to be called after either.  Off by
+   * default.
+   */
+  void set_cache_dirichlet_values (bool cache);
+
+  /**
+   * Forgets any Dirichlet values kept by set_cache_dirichlet_values(),
+   * so that the next create_dof_constraints() projects every boundary
+   * again.
+   */
+  void clear_dirichlet_values ();
+#endif
+
   /**
    * Adds a copy of the user-defined row to the constraint matrix, using
    * an inhomogeneous right-hand-side for the constraint equation.
@@ -1252,6 +1345,21 @@ private:
    */
   void invalidate_dofs(MeshBase & mesh) const;
 
+  /**
+   * Adds \p offset to the indices of all the dofs numbered on this
+   * processor, i.e. those on local nodes and active local elements.
+   */
+  void offset_local_dofs(MeshBase & mesh, const dof_id_type offset) const;
+
+  /**
+   * Renumbers the dofs numbered on this processor, which have to
+   * start at 0, in the order given by \p dof_ordering.  The dofs of
+   * each DofObject and variable group stay contiguous.
+   */
+  void reorder_local_dofs(MeshBase & mesh,
+                          const std::string & dof_ordering,
+                          const bool node_major_dofs) const;
+
   /**
    * \returns The Node pointer with index \p i from the \p mesh.
    */
@@ -1303,6 +1411,27 @@ private:
   void distribute_local_dofs_node_major (dof_id_type & next_free_dof,
                                          MeshBase & mesh);
 
+  /**
+   * Distributes the global degrees of freedom, for dofs on this
+   * processor, keeping the order of those already numbered here
+   * before the last mesh change and appending the new ones, then
+   * closing the gaps.  Starts at index 0, and sets next_free_dof to
+   * the post-final index.
+   *
+   * \returns \p false, without numbering anything, if there is no
+   * previous numbering on the same processors to start from.
+   */
+  bool distribute_local_dofs_incremental (dof_id_type & next_free_dof,
+                                          MeshBase & mesh);
+
+  /**
+   * Checks whether the degrees of freedom of each node and element
+   * form a block of the same size, and sets \p _block_size
+   * accordingly.  Must be called on all processors after the dofs
+   * have been distributed.  Only used with blocked storage enabled.
+   */
+  void compute_block_size (const MeshBase & mesh);
+
   /*
    * A utility method for obtaining a set of elements to ghost along
    * with merged coupling matrices.
@@ -1537,6 +1666,11 @@ private:
    */
   dof_id_type _n_SCALAR_dofs;
 
+  /**
+   * The size of the blocks of degrees of freedom, see \p block_size().
+   */
+  unsigned int _block_size;
+
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
@@ -1597,6 +1731,101 @@ private:
    */
   void check_dirichlet_bcid_consistency (const MeshBase & mesh,
                                          const DirichletBoundary & boundary) const;
+
+  /**
+   * \returns The values of the dofs constrained by \p boundary on
+   * the local elements \p elems at time \p time, in element order.
+   * If \p _cache_dirichlet_values is set, the values of a boundary
+   * whose functions are not time-dependent are reused, without
+   * \p elems, until they are cleared.
+   */
+  const std::vector<std::pair<dof_id_type, Number> > &
+  dirichlet_values (const MeshBase & mesh,
+                    const DirichletBoundary & boundary,
+                    std::vector<const Elem *> & elems,
+                    Real time);
+
+  /**
+   * The last values computed by dirichlet_values() for each
+   * Dirichlet boundary.
+   */
+  std::map<const DirichletBoundary *,
+           std::vector<std::pair<dof_id_type, Number> > > _dirichlet_values;
+
+  /**
+   * Whether \p _dirichlet_values are kept for reuse.
+   */
+  bool _cache_dirichlet_values;
+
+  /**
+   * Finds which of the constraints held here come directly from
+   * time-dependent Dirichlet boundaries on any processor.  Called by
+   * process_constraints() before it expands the constraint rows.
+   */
+  void find_time_dependent_dirichlet_roots ();
+
+  /**
+   * Finds which of the constraints \p dofs, sent here by their
+   * owners after processing, depend on time-dependent Dirichlet
+   * boundaries.
+   */
+  void find_remote_dirichlet_dependents (const std::vector<dof_id_type> & dofs);
+
+  /**
+   * Forgets which constraint values depend on time-dependent
+   * Dirichlet boundaries.
+   */
+  void clear_dirichlet_dependencies ();
+
+  /**
+   * The sorted dofs whose constraints each time-dependent primal
+   * Dirichlet boundary created on this processor.
+   */
+  std::map<const DirichletBoundary *, std::vector<dof_id_type> > _time_dependent_dirichlet_dofs;
+
+  /**
+   * The local elements on each of those boundaries, so that we don't
+   * have to search the mesh for them again.
+   */
+  std::map<const DirichletBoundary *, std::vector<const Elem *> > _time_dependent_dirichlet_elems;
+
+  /**
+   * The sorted dofs held here whose constraints come directly from
+   * time-dependent Dirichlet boundaries, on this or any other
+   * processor.
+   */
+  std::vector<dof_id_type> _time_dependent_dirichlet_roots;
+
+  /**
+   * The coefficients of the time-dependent Dirichlet roots in the
+   * value of each other processed constraint which depends on them.
+   */
+  DofConstraints _dirichlet_dependencies;
+
+  /**
+   * The sorted dofs whose processed constraints depend on
+   * time-dependent Dirichlet roots, but were only sent here by their
+   * owners after processing.
+   */
+  std::vector<dof_id_type> _remote_dirichlet_dependents;
+
+  /**
+   * Whether create_dof_constraints() tracks the dependencies above.
+   */
+  bool _allow_dirichlet_value_updates;
+
+  /**
+   * Whether the next process_constraints() has to find the
+   * dependencies above.
+   */
+  bool _find_dirichlet_dependencies;
+
+  /**
+   * Whether the dependencies above are complete for the current
+   * constraints.
+   */
+  bool _dirichlet_dependencies_found;
+
   /**
    * Data structure containing Dirichlet functions.  The ith
    * entry is the constraint matrix row for boundaryid i.
@@ -1618,6 +1847,19 @@ private:
    */
   bool _implicit_neighbor_dofs_initialized;
   bool _implicit_neighbor_dofs;
+
+  /**
+   * The ordering of the local dofs, and whether it overrides the
+   * --dof_ordering commandline option.
+   */
+  bool _dof_ordering_initialized;
+  std::string _dof_ordering;
+
+  /**
+   * Whether distribute_dofs() keeps the previous numbering where it
+   * can.
+   */
+  bool _incremental_dof_numbering;
 };
 
 
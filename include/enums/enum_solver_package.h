@@ -37,6 +37,7 @@ enum SolverPackage
     SLEPC_SOLVERS,
     EIGEN_SOLVERS,
     NLOPT_SOLVERS,
+    NATIVE_SOLVERS,
 
     INVALID_SOLVER_PACKAGE
   };
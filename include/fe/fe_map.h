@@ -537,6 +537,22 @@ protected:
    */
   void resize_quadrature_map_vectors(const unsigned int dim, unsigned int n_qp);
 
+  /**
+   * Computes the 3D map (without second derivatives) at all
+   * quadrature points at once.  The node sums are accumulated into
+   * structure-of-arrays storage so that the innermost loops run over
+   * contiguous quadrature point data and can be vectorized; \p N
+   * is the number of mapping nodes, with specializations for common
+   * element types, or 0 to take it from \p elem_nodes at run time.
+   *
+   * \returns \p false if a non-positive Jacobian was found, in which
+   * case the caller should fall back to compute_single_point_map()
+   * for its error handling.
+   */
+  template <unsigned int N>
+  bool compute_map_3D(const std::vector<Real> & qw,
+                      const std::vector<const Node *> & elem_nodes);
+
   /**
    * Used in \p FEMap::compute_map(), which should be
    * be usable in derived classes, and therefore protected.
@@ -906,6 +922,13 @@ private:
    * Work vector for compute_affine_map()
    */
   std::vector<const Node *> elem_nodes;
+
+  /**
+   * Work vector for compute_map_3D(): physical coordinates and
+   * their reference derivatives in structure-of-arrays layout, i.e.
+   * entry [c*n_qp + p] holds component c at quadrature point p.
+   */
+  std::vector<Real> _qp_map_data;
 };
 
 }
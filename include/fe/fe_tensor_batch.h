@@ -0,0 +1,243 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_TENSOR_BATCH_H
+#define LIBMESH_FE_TENSOR_BATCH_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+
+/**
+ * This class evaluates a tensor-product finite element space on a
+ * whole batch of elements of the same type at once, using
+ * sum-factorization.  Rather than building the full \p phi and \p
+ * dphi arrays for every element as \p FE::reinit() does, the
+ * interpolation from degrees of freedom to quadrature points (and
+ * the transposed integration back) is done one coordinate direction
+ * at a time with small 1D matrices, which costs O(p^{d+1}) instead of
+ * O(p^{2d}) operations per element.
+ *
+ * All field arrays are stored "batch-innermost": entry \p i of
+ * element \p b within the batch lives at index \p i*batch_size()+b,
+ * so that the innermost loops of every contraction run over
+ * contiguous memory across elements and vectorize naturally.
+ *
+ * Currently \p LAGRANGE \p FIRST and \p SECOND variables on \p QUAD4,
+ * \p QUAD9, \p HEX8 and \p HEX27 elements without p-refinement are
+ * supported, on meshes whose spatial dimension matches the element
+ * dimension; \p supports() can be used to check for a given element.
+ * The mapping is isoparametric with respect to the element's own
+ * nodes, and the Gauss rule uses one point per 1D mapping or
+ * solution node, whichever is more, in each direction.
+ *
+ * \brief Sum-factorization evaluation on batches of tensor-product elements.
+ */
+class FETensorBatch
+{
+public:
+
+  /**
+   * Scratch space for the contractions.  The evaluation methods
+   * themselves keep no state, so one \p FETensorBatch can be shared
+   * between threads as long as each of them passes its own \p
+   * Workspace.
+   */
+  struct Workspace
+  {
+    std::vector<Number> work1, work2, tmp;
+    std::vector<Real> rwork1, rwork2, jac;
+  };
+
+  /**
+   * Constructor.  Prepares the 1D bases for variables of type \p
+   * fe_type on elements of type \p elem_type, processed \p
+   * batch_size elements at a time.
+   */
+  FETensorBatch (const ElemType elem_type,
+                 const FEType & fe_type,
+                 const unsigned int batch_size = 8);
+
+  /**
+   * \returns \p true if variables of type \p fe_type on \p elem can
+   * be evaluated by this class in a mesh with spatial dimension \p
+   * spatial_dim.
+   */
+  static bool supports (const Elem & elem,
+                        const FEType & fe_type,
+                        const unsigned int spatial_dim);
+
+  /**
+   * \returns The number of elements processed together.
+   */
+  unsigned int batch_size () const { return _batch_size; }
+
+  /**
+   * \returns The element dimension.
+   */
+  unsigned int dim () const { return _dim; }
+
+  /**
+   * \returns The number of degrees of freedom per element.
+   */
+  unsigned int n_dofs () const { return _n_dofs; }
+
+  /**
+   * \returns The number of quadrature points per element.
+   */
+  unsigned int n_qp () const { return _n_qp; }
+
+  /**
+   * \returns The number of independent entries of the symmetric
+   * geometric factor computed by \p compute_geometry().
+   */
+  unsigned int n_geometry_terms () const { return _dim*(_dim+1)/2; }
+
+  /**
+   * \returns The element-local degree of freedom (which for Lagrange
+   * elements is also the local node number) corresponding to
+   * lexicographic tensor index \p i.
+   */
+  unsigned int tensor_to_dof (const unsigned int i) const
+  { return _dof_of_tensor[i]; }
+
+  /**
+   * Computes the quadrature data for the first \p n_elem (at most
+   * \p batch_size()) elements in \p elems.  On return \p JxW holds
+   * the weighted Jacobian determinant at every quadrature point, and
+   * \p G the symmetric tensor JxW*inv(J)*inv(J)^T, stored as
+   * n_geometry_terms() entries per quadrature point, in
+   * batch-innermost order.  Unused lanes of a partial batch are
+   * filled with a copy of the last element.
+   */
+  void compute_geometry (const Elem * const * elems,
+                         const unsigned int n_elem,
+                         std::vector<Real> & JxW,
+                         std::vector<Real> & G,
+                         Workspace & work) const;
+
+  /**
+   * Interpolates the tensor-ordered coefficients \p u (n_dofs() per
+   * lane) to the quadrature points.  If \p u_qp is non-NULL it
+   * receives the values, and if \p grad_qp is non-NULL it receives
+   * the gradients with respect to the reference coordinates, stored
+   * as dim() consecutive blocks of n_qp() entries per lane.
+   */
+  void interpolate (const Number * u,
+                    Number * u_qp,
+                    Number * grad_qp,
+                    Workspace & work) const;
+
+  /**
+   * Integrates values \p v_qp against the shape functions and
+   * reference gradients \p grad_qp against the shape function
+   * reference gradients, summing the result into the
+   * tensor-ordered coefficients \p v.  This is the transpose of \p
+   * interpolate(); either input may be NULL.
+   */
+  void integrate (const Number * v_qp,
+                  const Number * grad_qp,
+                  Number * v,
+                  Workspace & work) const;
+
+private:
+
+  /**
+   * Applies the \p m x \p n row-major 1D matrix \p A (or its
+   * transpose, which is then \p n x \p m) along direction \p axis of
+   * the tensor \p in with extents \p shape, writing the result to \p
+   * out.  On return \p shape holds the extents of \p out.
+   */
+  template <typename T>
+  void contract (const std::vector<Real> & A,
+                 const unsigned int m,
+                 const unsigned int n,
+                 const bool transpose,
+                 const unsigned int axis,
+                 unsigned int shape[3],
+                 const T * in,
+                 T * out) const;
+
+  /**
+   * Applies one 1D matrix per direction to \p in, i.e. the
+   * Kronecker product of \p A[0], ..., \p A[dim-1], using \p work1
+   * and \p work2 as scratch space.
+   */
+  template <typename T>
+  void apply_tensor (const std::vector<Real> * const * A,
+                     const unsigned int m,
+                     const unsigned int n,
+                     const bool transpose,
+                     const T * in,
+                     T * out,
+                     std::vector<T> & work1,
+                     std::vector<T> & work2) const;
+
+  /**
+   * Finds the lexicographic ordering of the element-local degrees
+   * of freedom of a Lagrange space of order \p order with \p n1d
+   * nodes per direction.
+   */
+  void build_tensor_map (const ElemType elem_type,
+                         const Order order,
+                         const unsigned int n1d,
+                         std::vector<unsigned int> & map) const;
+
+  const unsigned int _batch_size;
+
+  unsigned int _dim;
+
+  /**
+   * Number of 1D solution nodes, 1D mapping nodes and 1D quadrature
+   * points.
+   */
+  unsigned int _n_1d, _n_geom_1d, _n_q_1d;
+
+  unsigned int _n_dofs, _n_geom_nodes, _n_qp;
+
+  /**
+   * 1D solution and mapping shape function values and derivatives at
+   * the 1D quadrature points, as row-major (qp x node) matrices.
+   */
+  std::vector<Real> _phi_1d, _dphi_1d, _geom_phi_1d, _geom_dphi_1d;
+
+  /**
+   * 1D quadrature weights.
+   */
+  std::vector<Real> _w_1d;
+
+  /**
+   * Lexicographic tensor index to element-local dof/node number.
+   */
+  std::vector<unsigned int> _dof_of_tensor, _node_of_tensor;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_TENSOR_BATCH_H
@@ -122,12 +122,24 @@ public:
   virtual UniquePtr<Elem> build_side_ptr (const unsigned int i,
                                           bool proxy) libmesh_override;
 
+  /**
+   * Rebuilds a QUAD4 coincident with face i.
+   */
+  virtual void build_side_ptr (UniquePtr<Elem> & side,
+                               const unsigned int i) libmesh_override;
+
   /**
    * Builds a EDGE2 built coincident with edge i.
    * The \p UniquePtr<Elem> handles the memory aspect.
    */
   virtual UniquePtr<Elem> build_edge_ptr (const unsigned int i) libmesh_override;
 
+  /**
+   * Rebuilds an EDGE2 coincident with edge i.
+   */
+  virtual void build_edge_ptr (UniquePtr<Elem> & edge,
+                               const unsigned int i) libmesh_override;
+
   virtual void connectivity(const unsigned int sc,
                             const IOPackage iop,
                             std::vector<dof_id_type> & conn) const libmesh_override;
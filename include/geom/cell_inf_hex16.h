@@ -143,6 +143,12 @@ public:
   virtual UniquePtr<Elem> build_side_ptr (const unsigned int i,
                                           bool proxy) libmesh_override;
 
+  /**
+   * Rebuilds a QUAD8 or INFQUAD6 coincident with face i.
+   */
+  virtual void build_side_ptr (UniquePtr<Elem> & side,
+                               const unsigned int i) libmesh_override;
+
   /**
    * \returns An \p EDGE3 built coincident with edges 0 to 3, or \p
    * INFEDGE2 built coincident with edges 4 to 11.
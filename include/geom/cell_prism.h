@@ -128,6 +128,12 @@ public:
    */
   virtual UniquePtr<Elem> side_ptr (const unsigned int i) libmesh_override;
 
+  /**
+   * Rebuilds a primitive triangle or quad for face i.
+   */
+  virtual void side_ptr (UniquePtr<Elem> & side,
+                         const unsigned int i) libmesh_override;
+
 
 protected:
 
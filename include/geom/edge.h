@@ -138,12 +138,25 @@ public:
    */
   virtual UniquePtr<Elem> side_ptr (const unsigned int i) libmesh_override;
 
+  /**
+   * Rebuilds a NodeElem for the specified node.
+   */
+  virtual void side_ptr (UniquePtr<Elem> & side,
+                         const unsigned int i) libmesh_override;
+
   /**
    * \returns A pointer to a NodeElem for the specified node.
    */
   virtual UniquePtr<Elem> build_side_ptr (const unsigned int i,
                                           bool proxy) libmesh_override;
 
+  /**
+   * Rebuilds a NodeElem for the specified node.
+   */
+  virtual void build_side_ptr (UniquePtr<Elem> & side,
+                               const unsigned int i) libmesh_override
+  { this->side_ptr(side, i); }
+
   /**
    * The \p Elem::build_edge_ptr() member makes no sense for edges.
    */
@@ -677,6 +677,20 @@ public:
   virtual UniquePtr<Elem> side_ptr (unsigned int i) = 0;
   UniquePtr<const Elem> side_ptr (unsigned int i) const;
 
+  /**
+   * Resets \p side to an element coincident with side \p i, like the
+   * one returned by side_ptr(i), whose parent is this element.  If
+   * \p side already holds an element of the right type, only its
+   * nodes are reset, so that looping over many sides with the same
+   * \p side does not allocate any memory.
+   *
+   * \p side must not hold a proxy element, since resetting the
+   * nodes of a proxy would change the nodes of the element it was
+   * built from.
+   */
+  virtual void side_ptr (UniquePtr<Elem> & side, const unsigned int i);
+  void side_ptr (UniquePtr<const Elem> & side, const unsigned int i) const;
+
   /**
    * \returns A proxy element coincident with side \p i.
    *
@@ -711,6 +725,18 @@ public:
   virtual UniquePtr<Elem> build_side_ptr (const unsigned int i, bool proxy=true) = 0;
   UniquePtr<const Elem> build_side_ptr (const unsigned int i, bool proxy=true) const;
 
+  /**
+   * Resets \p side to a full-ordered element coincident with side
+   * \p i, whose parent is this element like that of the proxy
+   * returned by build_side_ptr(i).  If \p side already holds an
+   * element of the right type which was built by this function,
+   * only its nodes are reset, so that e.g. reinitializing an FE
+   * object on many sides does not allocate any memory.  A proxy
+   * element held by \p side is replaced, never modified.
+   */
+  virtual void build_side_ptr (UniquePtr<Elem> & side, const unsigned int i);
+  void build_side_ptr (UniquePtr<const Elem> & side, const unsigned int i) const;
+
   /**
    * \returns A proxy element coincident with side \p i.
    *
@@ -737,6 +763,14 @@ public:
   virtual UniquePtr<Elem> build_edge_ptr (const unsigned int i) = 0;
   UniquePtr<const Elem> build_edge_ptr (const unsigned int i) const;
 
+  /**
+   * Resets \p edge to a full-ordered element coincident with edge
+   * \p i, reusing its memory if it already holds an element of the
+   * right type.  See build_side_ptr().
+   */
+  virtual void build_edge_ptr (UniquePtr<Elem> & edge, const unsigned int i);
+  void build_edge_ptr (UniquePtr<const Elem> & edge, const unsigned int i) const;
+
   /**
    * Creates an element coincident with edge \p i.
    *
@@ -1471,6 +1505,39 @@ protected:
                                   dof_id_type n3);
 
 
+  /**
+   * Resets \p side to side \p i of this element, of type \p sidetype
+   * and with the nodes given by \p Mapclass::side_nodes_map, reusing
+   * the memory of \p side if possible.  This implements side_ptr()
+   * and build_side_ptr() for subclasses whose sides can be read off
+   * a node map.
+   */
+  template <typename Mapclass>
+  void simple_side_ptr (UniquePtr<Elem> & side,
+                        const unsigned int i,
+                        const ElemType sidetype);
+
+  /**
+   * The same for build_edge_ptr(), using
+   * \p Mapclass::edge_nodes_map.
+   */
+  template <typename Mapclass>
+  void simple_edge_ptr (UniquePtr<Elem> & edge,
+                        const unsigned int i,
+                        const ElemType edgetype);
+
+  /**
+   * Prepares \p elem, handed to simple_side_ptr() or
+   * simple_edge_ptr(), to be reset to a side or edge of this element
+   * of type \p type, giving it the parent, ids and p-level a newly
+   * built one would have.  \returns \p false, leaving \p elem
+   * alone, if it has to be replaced instead: if it is NULL, of
+   * another type, or a \p Side or \p SideEdge proxy, whose
+   * set_node() would write through to its own parent.
+   */
+  bool reuse_subelem (Elem * elem, const ElemType type);
+
+
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
@@ -1899,6 +1966,19 @@ UniquePtr<const Elem> Elem::side_ptr (unsigned int i) const
 
 
 
+inline
+void Elem::side_ptr (UniquePtr<const Elem> & side,
+                     const unsigned int i) const
+{
+  // Hand the side to the non-const version of this function and take
+  // it back afterwards.
+  UniquePtr<Elem> s(const_cast<Elem *>(side.release()));
+  const_cast<Elem *>(this)->side_ptr(s, i);
+  side.reset(s.release());
+}
+
+
+
 inline
 UniquePtr<Elem> Elem::side (const unsigned int i) const
 {
@@ -1923,6 +2003,19 @@ Elem::build_side_ptr (const unsigned int i, bool proxy) const
 
 
 
+inline
+void Elem::build_side_ptr (UniquePtr<const Elem> & side,
+                           const unsigned int i) const
+{
+  // Hand the side to the non-const version of this function and take
+  // it back afterwards.
+  UniquePtr<Elem> s(const_cast<Elem *>(side.release()));
+  const_cast<Elem *>(this)->build_side_ptr(s, i);
+  side.reset(s.release());
+}
+
+
+
 inline
 UniquePtr<Elem>
 Elem::build_side (const unsigned int i, bool proxy) const
@@ -1948,6 +2041,19 @@ Elem::build_edge_ptr (const unsigned int i) const
 
 
 
+inline
+void Elem::build_edge_ptr (UniquePtr<const Elem> & edge,
+                           const unsigned int i) const
+{
+  // Hand the edge to the non-const version of this function and take
+  // it back afterwards.
+  UniquePtr<Elem> e(const_cast<Elem *>(edge.release()));
+  const_cast<Elem *>(this)->build_edge_ptr(e, i);
+  edge.reset(e.release());
+}
+
+
+
 inline
 UniquePtr<Elem>
 Elem::build_edge (const unsigned int i) const
@@ -2398,6 +2504,40 @@ void Elem::hack_p_level(unsigned int p)
 #endif // ifdef LIBMESH_ENABLE_AMR
 
 
+template <typename Mapclass>
+inline
+void Elem::simple_side_ptr (UniquePtr<Elem> & side,
+                            const unsigned int i,
+                            const ElemType sidetype)
+{
+  libmesh_assert_less (i, this->n_sides());
+
+  if (!this->reuse_subelem(side.get(), sidetype))
+    side = Elem::build(sidetype, this);
+
+  for (unsigned int n=0; n != side->n_nodes(); ++n)
+    side->set_node(n) = this->node_ptr(Mapclass::side_nodes_map[i][n]);
+}
+
+
+
+template <typename Mapclass>
+inline
+void Elem::simple_edge_ptr (UniquePtr<Elem> & edge,
+                            const unsigned int i,
+                            const ElemType edgetype)
+{
+  libmesh_assert_less (i, this->n_edges());
+
+  if (!this->reuse_subelem(edge.get(), edgetype))
+    edge = Elem::build(edgetype, this);
+
+  for (unsigned int n=0; n != edge->n_nodes(); ++n)
+    edge->set_node(n) = this->node_ptr(Mapclass::edge_nodes_map[i][n]);
+}
+
+
+
 inline
 dof_id_type Elem::compute_key (dof_id_type n0)
 {
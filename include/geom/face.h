@@ -66,6 +66,10 @@ public:
   virtual UniquePtr<Elem> build_edge_ptr (const unsigned int i) libmesh_override
   { return build_side_ptr(i); }
 
+  virtual void build_edge_ptr (UniquePtr<Elem> & edge,
+                               const unsigned int i) libmesh_override
+  { this->build_side_ptr(edge, i); }
+
   /**
    * is_edge_on_side is trivial in 2D.
    */
@@ -150,6 +150,12 @@ public:
    */
   virtual UniquePtr<Elem> side_ptr (const unsigned int i) libmesh_override;
 
+  /**
+   * Rebuilds a primitive 2-noded edge for edge i.
+   */
+  virtual void side_ptr (UniquePtr<Elem> & side,
+                         const unsigned int i) libmesh_override;
+
   /**
    * \returns A quantitative assessment of element quality based on
    * the quality metric \p q specified by the user.
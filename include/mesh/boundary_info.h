@@ -95,6 +95,34 @@ public:
    */
   void regenerate_id_sets ();
 
+  /**
+   * Moves the node and side boundary ids out of their multimaps into
+   * flat arrays indexed by node and element id, with the ids of each
+   * node or element stored contiguously.  Lookups then take constant
+   * time, and the arrays take one offset per node or element id plus
+   * the ids themselves, instead of a tree node per id.  Called by
+   * MeshBase::prepare_for_use().
+   *
+   * All queries work on the frozen arrays.  Anything which adds or
+   * removes node or side ids, or renumbers the nodes or elements,
+   * calls thaw() first.
+   */
+  void freeze ();
+
+  /**
+   * \returns \p true if the node and side boundary ids have been
+   * frozen and not modified since.
+   */
+  bool is_frozen () const { return _frozen; }
+
+  /**
+   * Moves the node and side boundary ids frozen by freeze() back
+   * into their multimaps.  This must be called before the nodes or
+   * elements are renumbered, while their ids still match the frozen
+   * arrays.
+   */
+  void thaw ();
+
 
   /**
    * Generates \p boundary_mesh data structures corresponding to the
@@ -808,6 +836,29 @@ private:
                       std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map,
                       const std::set<subdomain_id_type> & subdomains_relative_to);
 
+  /**
+   * Frees the frozen arrays, without moving their contents back into
+   * the multimaps.
+   */
+  void _discard_frozen ();
+
+  /**
+   * \returns The range of \p _frozen_node_ids belonging to \p node.
+   */
+  std::pair<std::size_t, std::size_t> _frozen_node_range (const Node * node) const;
+
+  /**
+   * \returns The range of \p _frozen_side_ids belonging to \p elem.
+   */
+  std::pair<std::size_t, std::size_t> _frozen_side_range (const Elem * elem) const;
+
+  /**
+   * Fills \p entries with the (side, id) pairs of \p elem, from
+   * whichever of the multimap and the frozen arrays holds them.
+   */
+  void _side_entries (const Elem * elem,
+                      std::vector<std::pair<unsigned short int, boundary_id_type> > & entries) const;
+
   /**
    * The Mesh this boundary info pertains to.
    */
@@ -891,6 +942,28 @@ private:
    */
   std::set<boundary_id_type> _boundary_ids;
 
+  /**
+   * Whether the node and side boundary ids are in the frozen arrays
+   * below, rather than in \p _boundary_node_id and
+   * \p _boundary_side_id.
+   */
+  bool _frozen;
+
+  /**
+   * The ids of node \p i are stored in \p _frozen_node_ids, from
+   * \p _frozen_node_offsets[i] up to \p _frozen_node_offsets[i+1].
+   * The offsets stop after the last node with boundary ids.
+   */
+  std::vector<dof_id_type> _frozen_node_offsets;
+  std::vector<boundary_id_type> _frozen_node_ids;
+
+  /**
+   * The (side, id) pairs of each element, stored the same way as the
+   * node ids.
+   */
+  std::vector<dof_id_type> _frozen_side_offsets;
+  std::vector<std::pair<unsigned short int, boundary_id_type> > _frozen_side_ids;
+
   /**
    * Set of user-specified boundary IDs for sides *only*.  Note: _boundary_ids
    * is the union of this set, _edge_boundary_ids, _node_boundary_ids, and
@@ -67,14 +67,28 @@ public:
   GmshIO (const MeshBase & mesh);
 
   /**
-   * Reads in a mesh in the Gmsh *.msh format from the ASCII file
-   * given by name.
+   * Reads in a mesh in the Gmsh *.msh format from the ASCII or
+   * binary file given by name.  The file is mapped into memory and
+   * the nodes and elements are parsed on all threads.
    *
    * The user is responsible for calling Mesh::prepare_for_use()
    * after reading the mesh and before using it.
    */
   virtual void read (const std::string & name) libmesh_override;
 
+  /**
+   * Reads a mesh into a DistributedMesh without ever holding all of
+   * it on one processor.  Processor 0 reads the file and sends
+   * contiguous blocks of elements, with their nodes, to the other
+   * processors while it reads; its parsed records are discarded one
+   * batch at a time.  Each processor ends up with a linear partition
+   * of the elements plus its ghost neighbors, which the proper
+   * partitioner can improve on in prepare_for_use().
+   *
+   * This must be called on all processors at once.
+   */
+  void read_distributed (const std::string & name);
+
   /**
    * This method implements writing a mesh to a specified file
    * in the Gmsh *.msh format.
@@ -114,12 +128,41 @@ public:
   bool & write_lower_dimensional_elements ();
 
 private:
+  /**
+   * The state processor 0 shares with the others while
+   * read_distributed() sends them their elements.
+   */
+  struct DistributedRead;
+
   /**
    * Implementation of the read() function.  This function
    * is called by the public interface function and implements
-   * reading the file.
+   * reading the file, whose contents are given by the range
+   * [begin, end).  If \p distributed is given, the elements are
+   * sent to the other processors rather than all added here.
+   */
+  void read_mesh (const char * begin, const char * end,
+                  DistributedRead * distributed = libmesh_nullptr);
+
+  /**
+   * Adds the nodes and elements buffered in \p distributed to the
+   * mesh on this processor, and sets aside the boundary records
+   * among them.  The buffers are cleared.
+   */
+  void add_records (DistributedRead & distributed);
+
+  /**
+   * Sends the nodes and elements buffered in \p distributed to
+   * processor \p pid, or adds them here if that is this processor.
+   */
+  void send_records (DistributedRead & distributed,
+                     const processor_id_type pid);
+
+  /**
+   * Receives the nodes and elements processor 0 sends this processor
+   * until it sends an empty message.
    */
-  void read_mesh (std::istream & in);
+  void receive_records (DistributedRead & distributed);
 
   /**
    * This method implements writing a mesh to a
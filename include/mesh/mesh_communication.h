@@ -78,9 +78,27 @@ public:
    * processor 0) and broadcasts it to all the other processors.
    * It also broadcasts any boundary information the mesh has
    * associated with it.
+   *
+   * The mesh is sent to one processor per shared memory node first,
+   * and from there to the other processors on that node, so it
+   * crosses the network once per node.  Every processor still ends
+   * up with its own full copy of the mesh; SharedMeshStorage keeps a
+   * single copy per node instead.
    */
   void broadcast (MeshBase &) const;
 
+  /**
+   * This method takes a mesh (which is assumed to reside on
+   * processor 0) and sends each processor only the part of it that
+   * processor will keep: a contiguous block of elements, in the
+   * order of their ids, and the elements and nodes they need as
+   * ghosts.  Processor 0 then deletes the rest.  The mesh is left
+   * distributed, ready to be properly partitioned.  This avoids
+   * having a copy of the whole mesh on every processor, as broadcast()
+   * does.
+   */
+  void scatter (DistributedMesh &) const;
+
   /**
    * This method takes a parallel distributed mesh and redistributes
    * the elements.  Specifically, any elements stored on a given
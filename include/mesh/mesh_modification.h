@@ -24,6 +24,9 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/id_types.h" // for boundary_id_type, subdomain_id_type
 
+// C++ Includes
+#include <string>
+
 namespace libMesh
 {
 
@@ -157,6 +160,24 @@ void change_subdomain_id (MeshBase & mesh,
                           const subdomain_id_type old_id,
                           const subdomain_id_type new_id);
 
+/**
+ * Renumbers the elements of a serial mesh, and moves them in the
+ * mesh's storage, so that neighboring elements get nearby ids and
+ * are visited close to each other by element iterators.
+ * \p ordering is either "hilbert", for the order of a Hilbert curve
+ * through the element centroids, or "rcm", for a reverse
+ * Cuthill-McKee ordering of the graph of face neighbors.  Elements
+ * stay sorted by refinement level.  The nodes are then numbered in
+ * the order in which the elements first use them.
+ *
+ * This should be called after the mesh has been prepared for use,
+ * so that neighbor links exist, and before any systems are
+ * initialized.  Meshes which allow renumbering keep this order when
+ * they are prepared again.
+ */
+void reorder_nodes_and_elements (MeshBase & mesh,
+                                 const std::string & ordering);
+
 } // end namespace Meshtools::Modification
 } // end namespace MeshTools
 
@@ -115,6 +115,24 @@ public:
                                  const NumericVector<Number> &,
                                  const std::vector<std::string> &);
 
+  /**
+   * This method may be overridden by serial output formats which can
+   * write their nodal data incrementally.  It is passed the
+   * node-major parallel solution vector described above, is called
+   * on all processors, and is expected to fetch the nodal solution
+   * in blocks of at most \p nodal_data_block_size() nodes through
+   * EquationSystems::localize_solution_block().
+   *
+   * \returns \p false if not implemented, in which case
+   * write_equation_systems() localizes the whole solution vector to
+   * processor 0 and calls write_nodal_data() instead.
+   */
+  virtual bool write_nodal_data_blocks (const std::string &,
+                                        const EquationSystems &,
+                                        const NumericVector<Number> &,
+                                        const std::vector<std::string> &)
+  { return false; }
+
   /**
    * Return/set the precision to use when writing ASCII files.
    *
@@ -124,6 +142,13 @@ public:
    */
   unsigned int & ascii_precision ();
 
+  /**
+   * Return/set the maximum number of nodes whose solution values are
+   * gathered on processor 0 at once by formats which implement
+   * write_nodal_data_blocks().
+   */
+  dof_id_type & nodal_data_block_size ();
+
 protected:
 
 
@@ -162,6 +187,11 @@ private:
    * Precision to use when writing ASCII files.
    */
   unsigned int _ascii_precision;
+
+  /**
+   * Maximum number of nodes per block of streamed nodal data.
+   */
+  dof_id_type _nodal_data_block_size;
 };
 
 
@@ -177,7 +207,8 @@ MeshOutput<MT>::MeshOutput (const bool is_parallel_format, const bool serial_onl
   _is_parallel_format(is_parallel_format),
   _serial_only_needed_on_proc_0(serial_only_needed_on_proc_0),
   _obj(libmesh_nullptr),
-  _ascii_precision (std::numeric_limits<Real>::digits10 + 2)
+  _ascii_precision (std::numeric_limits<Real>::digits10 + 2),
+  _nodal_data_block_size (65536)
 {}
 
 
@@ -188,7 +219,8 @@ MeshOutput<MT>::MeshOutput (const MT & obj, const bool is_parallel_format, const
   _is_parallel_format(is_parallel_format),
   _serial_only_needed_on_proc_0(serial_only_needed_on_proc_0),
   _obj (&obj),
-  _ascii_precision (std::numeric_limits<Real>::digits10 + 2)
+  _ascii_precision (std::numeric_limits<Real>::digits10 + 2),
+  _nodal_data_block_size (65536)
 {
   if (!_is_parallel_format && !this->mesh().is_serial())
     {
@@ -229,6 +261,15 @@ unsigned int & MeshOutput<MT>::ascii_precision ()
 }
 
 
+
+template <class MT>
+inline
+dof_id_type & MeshOutput<MT>::nodal_data_block_size ()
+{
+  return _nodal_data_block_size;
+}
+
+
 } // namespace libMesh
 
 
@@ -38,6 +38,11 @@ namespace libMesh
  * locations inside the boundary!  This aspect could
  * use work.
  *
+ * The smoother works on distributed meshes: each processor only
+ * stores the graph of its local nodes, built from the local and
+ * ghost elements it already has, and ghost node positions are
+ * exchanged with the owning processors after every sweep.
+ *
  * \author John W. Peterson
  * \date 2002-2007
  */
@@ -83,25 +88,26 @@ public:
   /**
    * Mainly for debugging, this function will print
    * out the connectivity graph which has been created.
+   * Only the (local) nodes owned by this processor are
+   * printed.
    */
   void print_graph(std::ostream & out = libMesh::out) const;
 
 private:
-  /**
-   * This function allgather's the (local) graph after
-   * it is computed on each processor by the init() function.
-   */
-  void allgather_graph();
-
   /**
    * True if the L-graph has been created, false otherwise.
    */
   bool _initialized;
 
   /**
-   * Data structure for holding the L-graph
+   * Data structure for holding the L-graph of the local vertex
+   * nodes, in compressed row format: the neighbors of node
+   * \p _graph_nodes[i] are the entries
+   * [_graph_offsets[i], _graph_offsets[i+1]) of \p _graph.
    */
-  std::vector<std::vector<dof_id_type> > _graph;
+  std::vector<dof_id_type> _graph_nodes;
+  std::vector<std::size_t> _graph_offsets;
+  std::vector<dof_id_type> _graph;
 };
 
 
@@ -74,7 +74,8 @@ public:
                           unsigned miniterBC=5);
 
   /**
-   * Slightly more complicated constructor for mesh redistribution based on adapt_data
+   * Slightly more complicated constructor for mesh redistribution based on adapt_data,
+   * which is indexed by element id like an ErrorVector
    */
   VariationalMeshSmoother(UnstructuredMesh & mesh,
                           std::vector<float> * adapt_data,
@@ -128,6 +129,11 @@ public:
    * The actual smoothing function, gets called whenever
    * the user specifies an actual number of smoothing
    * iterations.
+   *
+   * On a distributed mesh each processor smooths the elements it
+   * has, local and ghost, keeping the nodes it shares with remote
+   * elements fixed, and then takes the positions of ghost nodes
+   * from their owners.
    */
   double smooth(unsigned int n_iterations);
 
@@ -258,6 +264,14 @@ private:
   };
 
 
+  /**
+   * Thread-parallel evaluation of the smoothing functional (and of
+   * the quality measures which accompany it) over all cells for a
+   * trial set of nodal positions.  Used in the line searches of
+   * minJ().
+   */
+  class FunctionalEvaluator;
+
   int writegr(const Array2D<double> & R);
 
   int readgr(Array2D<double> & R,
@@ -176,6 +176,24 @@ create_nodal_bounding_box (const MeshBase & mesh);
 libMesh::BoundingBox
 create_local_bounding_box (const MeshBase & mesh);
 
+/**
+ * Fills \p order with the indices of \p points in the order of a
+ * Hilbert curve through their bounding box, which keeps nearby
+ * points close together.  Points at the same position keep their
+ * relative order.  Requires libHilbert.
+ */
+void hilbert_order (const std::vector<Point> & points,
+                    std::vector<dof_id_type> & order);
+
+/**
+ * Fills \p order with the vertices of \p graph, given by the lists
+ * of their neighbors without duplicates, in reverse Cuthill-McKee
+ * order.  Numbering the vertices in this order reduces the bandwidth
+ * of the graph's adjacency matrix.
+ */
+void reverse_cuthill_mckee_order (const std::vector<std::vector<dof_id_type> > & graph,
+                                  std::vector<dof_id_type> & order);
+
 /**
  * \returns Two points defining a cartesian box that bounds the
  * elements belonging to processor pid.
@@ -0,0 +1,302 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SHARED_MESH_STORAGE_H
+#define LIBMESH_SHARED_MESH_STORAGE_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/id_types.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * Holds the node coordinates, element connectivity and boundary ids
+ * of a whole, unrefined mesh in a single copy per shared memory node.
+ *
+ * With MPI-3 the data live in a shared memory window which all the
+ * processors on a node read from; otherwise every processor holds its
+ * own copy.  The data are read-only once stored.
+ *
+ * This lets every processor look up any node or element of the mesh,
+ * while the \p Node and \p Elem objects, with their per-processor
+ * \p DofObject data, are only built where they are needed:
+ * build_mesh() fills a \p DistributedMesh with just the local
+ * elements and a layer of ghost elements around them, so the memory
+ * a mesh takes on a node no longer grows with the number of
+ * processors on it.  A \p ReplicatedMesh built from the storage still
+ * holds a full copy on each processor.
+ */
+class SharedMeshStorage : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  The storage is empty until store() is called.
+   */
+  explicit
+  SharedMeshStorage (const Parallel::Communicator & comm_in);
+
+  /**
+   * Destructor.  Frees the shared memory, so like the constructor it
+   * must be called on every processor at once.
+   */
+  ~SharedMeshStorage ();
+
+  /**
+   * Stores \p mesh, which only needs to be complete on processor 0;
+   * the other processors may hold any part of it, or none.  The
+   * nodes and elements must be numbered contiguously from zero, and
+   * the mesh must not be refined.  Element sides and nodes with
+   * boundary ids keep them, together with the boundary and subdomain
+   * names.
+   *
+   * This function must be run on all processors at once.
+   */
+  void store (const MeshBase & mesh);
+
+  /**
+   * Frees the stored data.  This function must be run on all
+   * processors at once.
+   */
+  void clear ();
+
+  /**
+   * Adds the stored nodes and elements to \p mesh, which should be
+   * empty.  A replicated mesh gets all of them, a distributed one the
+   * elements owned by this processor and every element which shares
+   * a node with one of them, with links to \p remote_elem where the
+   * rest of the mesh is missing.  The nodes and elements keep their
+   * stored ids and processor ids; to keep them through
+   * prepare_for_use() as well, call mesh.allow_renumbering(false) and
+   * mesh.skip_partitioning(true) first.
+   *
+   * This function must be run on all processors at once.
+   */
+  void build_mesh (MeshBase & mesh) const;
+
+  /**
+   * \returns The number of stored nodes.
+   */
+  dof_id_type n_nodes () const { return _n_nodes; }
+
+  /**
+   * \returns The number of stored elements.
+   */
+  dof_id_type n_elem () const { return _n_elem; }
+
+  /**
+   * \returns The location of node \p i.
+   */
+  Point point (const dof_id_type i) const;
+
+  /**
+   * \returns The processor id of node \p i.
+   */
+  processor_id_type node_processor_id (const dof_id_type i) const;
+
+  /**
+   * \returns The type of element \p e.
+   */
+  ElemType elem_type (const dof_id_type e) const;
+
+  /**
+   * \returns The subdomain id of element \p e.
+   */
+  subdomain_id_type subdomain_id (const dof_id_type e) const;
+
+  /**
+   * \returns The processor id of element \p e.
+   */
+  processor_id_type elem_processor_id (const dof_id_type e) const;
+
+  /**
+   * \returns The number of nodes of element \p e.
+   */
+  unsigned int n_elem_nodes (const dof_id_type e) const;
+
+  /**
+   * \returns The id of the node \p n of element \p e.
+   */
+  dof_id_type elem_node_id (const dof_id_type e,
+                            const unsigned int n) const;
+
+  /**
+   * \returns \p true if the data are in a window shared by all the
+   * processors on this node, \p false if this processor holds its own
+   * copy.
+   */
+  bool shared () const { return _shared; }
+
+private:
+
+  /**
+   * Points the arrays below into \p _data, if it is set, given the
+   * counts they are sized by.
+   *
+   * \returns The number of bytes the arrays take.
+   */
+  std::size_t set_arrays ();
+
+  /**
+   * The number of nodes, elements, connectivity entries, boundary
+   * sides and boundary nodes stored.
+   */
+  dof_id_type _n_nodes, _n_elem, _n_connectivity, _n_side_bcs, _n_node_bcs;
+
+  /**
+   * The stored data, and their size in bytes.
+   */
+  char * _data;
+  std::size_t _size;
+
+  /**
+   * Whether \p _data is in a shared memory window.
+   */
+  bool _shared;
+
+#ifdef LIBMESH_HAVE_MPI
+  /**
+   * The shared memory window, if any.
+   */
+  MPI_Win _window;
+#endif
+
+  /**
+   * The data, when they are not in a shared memory window.
+   */
+  std::vector<char> _private_data;
+
+  /**
+   * The arrays within \p _data.  Node coordinates are stored
+   * \p LIBMESH_DIM at a time, and the node ids of element \p e are
+   * \p _connectivity[_elem_offsets[e]] up to
+   * \p _connectivity[_elem_offsets[e+1]].
+   */
+  Real * _points;
+  processor_id_type * _node_procids;
+  dof_id_type * _elem_offsets;
+  dof_id_type * _connectivity;
+  unsigned char * _elem_types;
+  subdomain_id_type * _subdomain_ids;
+  processor_id_type * _elem_procids;
+  dof_id_type * _side_bc_elems;
+  unsigned short int * _side_bc_sides;
+  boundary_id_type * _side_bc_ids;
+  dof_id_type * _node_bc_nodes;
+  boundary_id_type * _node_bc_ids;
+#ifdef LIBMESH_ENABLE_UNIQUE_ID
+  unique_id_type * _node_unique_ids;
+  unique_id_type * _elem_unique_ids;
+#endif
+
+  /**
+   * The names of the subdomains, sidesets and nodesets, which each
+   * processor keeps its own copy of.
+   */
+  std::map<subdomain_id_type, std::string> _subdomain_names;
+  std::map<boundary_id_type, std::string> _sideset_names, _nodeset_names;
+};
+
+
+
+// ------------------------------------------------------------
+// SharedMeshStorage inline methods
+inline
+Point SharedMeshStorage::point (const dof_id_type i) const
+{
+  libmesh_assert_less (i, _n_nodes);
+
+  Point p;
+  for (unsigned int d=0; d != LIBMESH_DIM; ++d)
+    p(d) = _points[LIBMESH_DIM*i + d];
+  return p;
+}
+
+
+
+inline
+processor_id_type SharedMeshStorage::node_processor_id (const dof_id_type i) const
+{
+  libmesh_assert_less (i, _n_nodes);
+  return _node_procids[i];
+}
+
+
+
+inline
+ElemType SharedMeshStorage::elem_type (const dof_id_type e) const
+{
+  libmesh_assert_less (e, _n_elem);
+  return static_cast<ElemType>(_elem_types[e]);
+}
+
+
+
+inline
+subdomain_id_type SharedMeshStorage::subdomain_id (const dof_id_type e) const
+{
+  libmesh_assert_less (e, _n_elem);
+  return _subdomain_ids[e];
+}
+
+
+
+inline
+processor_id_type SharedMeshStorage::elem_processor_id (const dof_id_type e) const
+{
+  libmesh_assert_less (e, _n_elem);
+  return _elem_procids[e];
+}
+
+
+
+inline
+unsigned int SharedMeshStorage::n_elem_nodes (const dof_id_type e) const
+{
+  libmesh_assert_less (e, _n_elem);
+  return cast_int<unsigned int>(_elem_offsets[e+1] - _elem_offsets[e]);
+}
+
+
+
+inline
+dof_id_type SharedMeshStorage::elem_node_id (const dof_id_type e,
+                                             const unsigned int n) const
+{
+  libmesh_assert_less (n, this->n_elem_nodes(e));
+  return _connectivity[_elem_offsets[e] + n];
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_SHARED_MESH_STORAGE_H
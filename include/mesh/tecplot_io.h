@@ -74,6 +74,16 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) libmesh_override;
 
+  /**
+   * This method implements writing a mesh with nodal data to an
+   * ASCII file while gathering the nodal data onto processor 0 one
+   * block of nodes at a time.  Binary output is not streamed.
+   */
+  virtual bool write_nodal_data_blocks (const std::string &,
+                                        const EquationSystems &,
+                                        const NumericVector<Number> &,
+                                        const std::vector<std::string> &) libmesh_override;
+
   /**
    * Flag indicating whether or not to write a binary file
    * (if the tecio.a library was found by \p configure).
@@ -117,6 +127,29 @@ private:
                     const std::vector<Number> * = libmesh_nullptr,
                     const std::vector<std::string> * = libmesh_nullptr);
 
+  /**
+   * Writes the ASCII file header, including the variable names if
+   * they are provided.
+   */
+  void write_ascii_header (std::ostream &,
+                           const std::vector<std::string> * = libmesh_nullptr);
+
+  /**
+   * Writes the coordinates of the nodes with ids in [first, last),
+   * followed by their (node-major) nodal data \p v if the variable
+   * names are provided.  \p v holds the data of node \p first first.
+   */
+  void write_ascii_nodes (std::ostream &,
+                          const dof_id_type first,
+                          const dof_id_type last,
+                          const std::vector<Number> * = libmesh_nullptr,
+                          const std::vector<std::string> * = libmesh_nullptr);
+
+  /**
+   * Writes the connectivity of the active elements.
+   */
+  void write_ascii_connectivity (std::ostream &);
+
   /**
    * This method implements writing a mesh with nodal data to a
    * specified file where the nodal data and variable names are optionally
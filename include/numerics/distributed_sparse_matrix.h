@@ -0,0 +1,349 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
+#define LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
+
+// Local includes
+#include "libmesh/sparse_matrix.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DenseMatrix;
+template <typename T> class DistributedVector;
+template <typename T> class KrylovLinearSolver;
+
+/**
+ * The DistributedSparseMatrix class is libMesh's own parallel sparse
+ * matrix, which works with \p DistributedVector and does not need
+ * any external solver package.  Each processor stores its rows in
+ * compressed sparse row (CSR) format with global column indices.
+ *
+ * The storage is allocated up front, either from the full sparsity
+ * pattern computed by the \p DofMap or with a fixed number of slots
+ * per row.  Entries can then be added concurrently from several
+ * threads.  Contributions to rows owned by other processors are
+ * stashed and sent to their owners in \p close().
+ *
+ * Matrix-vector products are threaded over the local rows.  The
+ * off-processor vector entries a product needs are exchanged with a
+ * communication pattern which is set up once per sparsity pattern.
+ *
+ * \brief Native parallel CSR matrix.
+ */
+template <typename T>
+class DistributedSparseMatrix libmesh_final : public SparseMatrix<T>
+{
+
+public:
+  /**
+   * Constructor; initializes the matrix to be empty, without any
+   * structure.  You have to initialize the matrix before usage with
+   * \p init(...).
+   */
+  DistributedSparseMatrix (const Parallel::Communicator & comm
+                           LIBMESH_CAN_DEFAULT_TO_COMMWORLD);
+
+  /**
+   * Destructor.
+   */
+  ~DistributedSparseMatrix ();
+
+  /**
+   * The \p DistributedSparseMatrix uses the full sparsity pattern,
+   * so that no memory is wasted on slots which are never used.
+   */
+  virtual bool need_full_sparsity_pattern() const libmesh_override
+  { return true; }
+
+  /**
+   * Builds the CSR structure of the local rows from the graph
+   * computed by the \p DofMap.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::Graph &) libmesh_override;
+
+  /**
+   * Initialize a matrix of global dimension \f$ m \times n \f$ with
+   * local dimensions \f$ m_l \times n_l \f$, with room for
+   * \p nnz + \p noz entries in each row.  Entries are inserted as
+   * they are first added; adding more than that to a row is an error.
+   */
+  virtual void init (const numeric_index_type m,
+                     const numeric_index_type n,
+                     const numeric_index_type m_l,
+                     const numeric_index_type n_l,
+                     const numeric_index_type nnz=30,
+                     const numeric_index_type noz=10,
+                     const numeric_index_type blocksize=1) libmesh_override;
+
+  /**
+   * Initialize using the sizes of the attached \p DofMap.  If the
+   * sparsity pattern has not been provided yet, the rows are
+   * preallocated using the \p DofMap's estimated numbers of nonzeros.
+   */
+  virtual void init () libmesh_override;
+
+  /**
+   * Release all memory and return to a state just like after having
+   * called the default constructor.
+   */
+  virtual void clear () libmesh_override;
+
+  /**
+   * Set all entries to 0, keeping the sparsity pattern.
+   */
+  virtual void zero () libmesh_override;
+
+  /**
+   * Sends the stashed off-processor contributions to their owners
+   * and, if new nonzeros appeared, updates the communication pattern
+   * for matrix-vector products.  Must be called on all processors.
+   */
+  virtual void close () const libmesh_override;
+
+  /**
+   * \returns The row-dimension of the matrix.
+   */
+  virtual numeric_index_type m () const libmesh_override;
+
+  /**
+   * \returns The column-dimension of the matrix.
+   */
+  virtual numeric_index_type n () const libmesh_override;
+
+  /**
+   * \returns The index of the first matrix row stored on this
+   * processor.
+   */
+  virtual numeric_index_type row_start () const libmesh_override;
+
+  /**
+   * \returns The index of the last matrix row (+1) stored on this
+   * processor.
+   */
+  virtual numeric_index_type row_stop () const libmesh_override;
+
+  /**
+   * Set the element \p (i,j) to \p value.  Row \p i has to be local.
+   */
+  virtual void set (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) libmesh_override;
+
+  /**
+   * Add \p value to the element \p (i,j).  Throws an error if the
+   * entry is not in the sparsity pattern and cannot be inserted.
+   */
+  virtual void add (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) libmesh_override;
+
+  /**
+   * Add the full matrix \p dm to the rows \p rows and columns \p
+   * cols.  This may be called concurrently from several threads.
+   */
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols) libmesh_override;
+
+  /**
+   * Same, but assumes the row and column maps are the same.
+   * Thus the matrix \p dm must be square.
+   */
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & dof_indices) libmesh_override;
+
+  /**
+   * Compute \f$ this += a*X \f$.  This is a simple loop over the
+   * values if both matrices have the same sparsity pattern.
+   */
+  virtual void add (const T a, SparseMatrix<T> & X) libmesh_override;
+
+  /**
+   * \returns The value of the entry \p (i,j), which has to be in a
+   * local row.
+   */
+  virtual T operator () (const numeric_index_type i,
+                         const numeric_index_type j) const libmesh_override;
+
+  /**
+   * \returns The l1-norm of the matrix, the maximum column sum.
+   */
+  virtual Real l1_norm () const libmesh_override;
+
+  /**
+   * \returns The linfty-norm of the matrix, the maximum row sum.
+   */
+  virtual Real linfty_norm () const libmesh_override;
+
+  /**
+   * \returns \p true if the matrix has been closed.
+   */
+  virtual bool closed() const libmesh_override { return _closed; }
+
+  /**
+   * Print the contents of the matrix, by default to libMesh::out.
+   * Currently identical to \p print().
+   */
+  virtual void print_personal(std::ostream & os=libMesh::out) const libmesh_override { this->print(os); }
+
+  /**
+   * Copies the diagonal part of the matrix into \p dest.
+   */
+  virtual void get_diagonal (NumericVector<T> & dest) const libmesh_override;
+
+  /**
+   * Copies the transpose of the matrix into \p dest, which may be
+   * *this.
+   */
+  virtual void get_transpose (SparseMatrix<T> & dest) const libmesh_override;
+
+private:
+
+  /**
+   * Adds \f$ A x \f$ (or \f$ A^T x \f$, if \p transpose is true) to
+   * \p y, where \p x and \p y are the local values of distributed
+   * vectors.  Must be called on all processors.
+   */
+  void vector_mult_add_local (const std::vector<T> & x,
+                              std::vector<T> & y,
+                              const bool transpose) const;
+
+  /**
+   * Sets up the local and global sizes of an empty matrix.
+   */
+  void init_sizes (const numeric_index_type m,
+                   const numeric_index_type n,
+                   const numeric_index_type m_l,
+                   const numeric_index_type n_l);
+
+  /**
+   * \returns A reference to the value of the entry in local row \p
+   * i_local and global column \p j, inserting it into a free slot of
+   * the row if necessary.  The caller has to hold the row lock.
+   */
+  T & entry (const numeric_index_type i_local,
+             const numeric_index_type j);
+
+  /**
+   * Adds \p value to the entry \p (i,j), stashing it if \p i is not
+   * a local row.
+   */
+  void add_or_stash (const numeric_index_type i,
+                     const numeric_index_type j,
+                     const T value);
+
+  /**
+   * Builds the mapping from column indices to positions in the local
+   * part of a vector followed by the off-processor entries, and the
+   * pattern for exchanging those entries.
+   */
+  void setup_communication () const;
+
+  /**
+   * \returns The lock which protects local row \p i_local.
+   */
+  Threads::spin_mutex & row_lock (const numeric_index_type i_local) const
+  { return _row_locks[i_local % n_row_locks]; }
+
+  /**
+   * The global dimensions, and the ranges of rows and columns owned
+   * by this processor.
+   */
+  numeric_index_type _m, _n;
+  numeric_index_type _row_start, _row_stop;
+  numeric_index_type _col_start, _col_stop;
+
+  /**
+   * The first row (column) owned by each processor, plus _m (_n) at
+   * the end.
+   */
+  std::vector<numeric_index_type> _row_ranges, _col_ranges;
+
+  /**
+   * Row \p i uses the first _row_lengths[i] of the slots
+   * [_row_offsets[i], _row_offsets[i+1]) in _col_indices and
+   * _values.  The used column indices of each row are sorted.
+   */
+  std::vector<std::size_t> _row_offsets;
+  std::vector<numeric_index_type> _row_lengths;
+  std::vector<numeric_index_type> _col_indices;
+  std::vector<T> _values;
+
+  /**
+   * The position of each column index in a vector holding the local
+   * entries of the input vector followed by the \p _ghost_cols.
+   */
+  mutable std::vector<numeric_index_type> _compact_cols;
+
+  /**
+   * The sorted off-processor columns of the local rows.
+   */
+  mutable std::vector<numeric_index_type> _ghost_cols;
+
+  /**
+   * Number of ghost values we receive from, and local values we send
+   * to, each processor in a matrix-vector product, and the local
+   * indices of the values to send.
+   */
+  mutable std::vector<int> _recv_counts, _send_counts;
+  mutable std::vector<numeric_index_type> _send_indices;
+
+  /**
+   * True if _compact_cols and the communication pattern are out of
+   * date.
+   */
+  mutable bool _needs_setup;
+
+  /**
+   * Contributions to rows owned by other processors.
+   */
+  mutable std::vector<numeric_index_type> _stash_rows, _stash_cols;
+  mutable std::vector<T> _stash_values;
+
+  /**
+   * Flag indicating if the matrix has been closed yet.
+   */
+  mutable bool _closed;
+
+  /**
+   * Locks for concurrent insertion, shared by the rows in a round
+   * robin fashion, and a lock for the stash and for _needs_setup.
+   */
+  static const unsigned int n_row_locks = 64;
+  mutable Threads::spin_mutex _row_locks[n_row_locks];
+  mutable Threads::spin_mutex _stash_lock;
+
+  /**
+   * Make other native datatypes friends
+   */
+  friend class DistributedVector<T>;
+  friend class KrylovLinearSolver<T>;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
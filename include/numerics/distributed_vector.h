@@ -318,21 +318,19 @@ public:
    * Adds the product of a SparseMatrix \p A and a NumericVector \p
    * v to this vector, i.e. \f$u += A v \f$.
    *
-   * Not implemented.
+   * \p A has to be a \p DistributedSparseMatrix.
    */
-  virtual void add_vector (const NumericVector<T> &,
-                           const SparseMatrix<T> &) libmesh_override
-  { libmesh_not_implemented(); }
+  virtual void add_vector (const NumericVector<T> & v,
+                           const SparseMatrix<T> & A) libmesh_override;
 
   /**
    * Adds the product of a SparseMatrix \p A^T and a NumericVector \p
    * v to this vector, i.e. \f$u += A^T v \f$.
    *
-   * Not implemented.
+   * \p A has to be a \p DistributedSparseMatrix.
    */
-  virtual void add_vector_transpose (const NumericVector<T> &,
-                                     const SparseMatrix<T> &) libmesh_override
-  { libmesh_not_implemented(); }
+  virtual void add_vector_transpose (const NumericVector<T> & v,
+                                     const SparseMatrix<T> & A) libmesh_override;
 
   /**
    * Scale each element of the vector by the given factor.
@@ -0,0 +1,182 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MATRIX_FREE_SHELL_MATRIX_H
+#define LIBMESH_MATRIX_FREE_SHELL_MATRIX_H
+
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/shell_matrix.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/auto_ptr.h"
+
+// C++ includes
+#include <map>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class System;
+class Elem;
+class FETensorBatch;
+
+/**
+ * This class applies the operator
+ *
+ *   \f$ A = \alpha M + \beta K \f$,
+ *
+ * where \f$ M \f$ and \f$ K \f$ are the mass and Laplace stiffness
+ * matrices of one variable of a \p System, without ever assembling
+ * \f$ A \f$.  Each \p vector_mult() streams over the active local
+ * elements, so the memory traffic is that of the vectors and a small
+ * amount of cached geometric data instead of that of a sparse
+ * matrix, which pays off for higher order elements.
+ *
+ * Elements which \p FETensorBatch supports are processed in batches
+ * using sum-factorization; all others fall back to a standard \p
+ * FEBase evaluation, one element at a time.  The geometric data is
+ * computed on the first use; call \p clear() if the mesh or the \p
+ * DofMap changes afterwards.
+ *
+ * Constrained degrees of freedom are not supported yet.
+ *
+ * \brief Matrix-free mass/stiffness operator for one variable.
+ */
+template <typename T>
+class MatrixFreeShellMatrix : public ShellMatrix<T>
+{
+public:
+  /**
+   * Constructor; applies \p mass_coefficient times the mass matrix
+   * plus \p stiffness_coefficient times the stiffness matrix of
+   * variable \p var of \p system.  The system has to outlive this
+   * object.
+   */
+  MatrixFreeShellMatrix (const System & system,
+                         const unsigned int var,
+                         const Real mass_coefficient,
+                         const Real stiffness_coefficient,
+                         const unsigned int batch_size = 8);
+
+  /**
+   * Destructor.
+   */
+  virtual ~MatrixFreeShellMatrix ();
+
+  /**
+   * \returns \p m, the row-dimension of the matrix where the marix is
+   * \f$ M \times N \f$.
+   */
+  virtual numeric_index_type m () const libmesh_override;
+
+  /**
+   * \returns \p n, the column-dimension of the matrix where the marix
+   * is \f$ M \times N \f$.
+   */
+  virtual numeric_index_type n () const libmesh_override;
+
+  /**
+   * Multiplies the matrix with \p arg and stores the result in \p
+   * dest.
+   */
+  virtual void vector_mult (NumericVector<T> & dest,
+                            const NumericVector<T> & arg) const libmesh_override;
+
+  /**
+   * Multiplies the matrix with \p arg and adds the result to \p dest.
+   */
+  virtual void vector_mult_add (NumericVector<T> & dest,
+                                const NumericVector<T> & arg) const libmesh_override;
+
+  /**
+   * Copies the diagonal part of the matrix into \p dest.
+   */
+  virtual void get_diagonal (NumericVector<T> & dest) const libmesh_override;
+
+  /**
+   * Throws away the cached element batches and geometric data.
+   */
+  void clear ();
+
+private:
+
+  /**
+   * A group of elements of the same type which are processed by
+   * sum-factorization.
+   */
+  struct TensorGroup
+  {
+    UniquePtr<FETensorBatch> fe;
+
+    /**
+     * The elements of this type.
+     */
+    std::vector<const Elem *> elems;
+
+    /**
+     * Global dof indices in tensor order, n_dofs() per element.
+     */
+    std::vector<dof_id_type> dof_indices;
+
+    /**
+     * Cached geometric data, one \p FETensorBatch::compute_geometry()
+     * block per batch.
+     */
+    std::vector<Real> JxW, G;
+  };
+
+  /**
+   * Sorts the active local elements into groups and precomputes
+   * their geometric data.
+   */
+  void init () const;
+
+  /**
+   * Adds the action on \p local (or, if \p local is NULL, the
+   * diagonal) of the operator restricted to \p elems to \p dest,
+   * using a standard \p FEBase evaluation.
+   */
+  void generic_element_loop (const std::vector<const Elem *> & elems,
+                             const NumericVector<T> * local,
+                             NumericVector<T> & dest) const;
+
+  const System & _system;
+
+  const unsigned int _var;
+
+  const Real _mass_coefficient, _stiffness_coefficient;
+
+  const unsigned int _batch_size;
+
+  mutable bool _initialized;
+
+  mutable std::map<ElemType, TensorGroup> _tensor_groups;
+
+  /**
+   * Elements which are not handled by \p FETensorBatch.
+   */
+  mutable std::vector<const Elem *> _generic_elems;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MATRIX_FREE_SHELL_MATRIX_H
@@ -675,6 +675,13 @@ public:
    */
   void split(int color, int key, Communicator & target) const;
 
+  /*
+   * Create a new communicator between the processors of \p this
+   * which can share memory, i.e. which run on the same node.  Without
+   * MPI-3 every processor is put in a communicator of its own.
+   */
+  void split_shared(int key, Communicator & target) const;
+
   /*
    * Create a new duplicate of \p this communicator
    */
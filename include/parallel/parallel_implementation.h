@@ -661,6 +661,30 @@ inline void Communicator::split(int, int, Communicator & target) const
 }
 #endif
 
+#ifdef LIBMESH_HAVE_MPI
+inline void Communicator::split_shared(int key, Communicator & target) const
+{
+#if MPI_VERSION > 2
+  target.clear();
+  MPI_Comm newcomm;
+  libmesh_call_mpi
+    (MPI_Comm_split_type(this->get(), MPI_COMM_TYPE_SHARED, key,
+                         MPI_INFO_NULL, &newcomm));
+
+  target.assign(newcomm);
+  target._I_duped_it = true;
+  target.send_mode(this->send_mode());
+#else
+  this->split(this->rank(), key, target);
+#endif
+}
+#else
+inline void Communicator::split_shared(int, Communicator & target) const
+{
+  target.assign(this->get());
+}
+#endif
+
 inline void Communicator::duplicate(const Communicator & comm)
 {
   this->duplicate(comm._communicator);
@@ -120,24 +120,32 @@ private:
   std::vector<KeyType> _my_bin;
 
   /**
-   * Sorts the local data into bins across all processors.
-   * Right now it constructs a BenSorter<KeyType> object.
-   * In the future this could be a template parameter.
+   * Offsets of the sorted runs received from each processor
+   * within _my_bin, as left by communicate_bins().
    */
-  void binsort ();
+  std::vector<std::size_t> _bin_run_offsets;
+
+  /**
+   * Sorts the local data into bins across all processors.  The bin
+   * boundaries are chosen from a sample of the data, ranked exactly
+   * against the \p global_data_size keys, so that every processor
+   * ends up with about the same number of keys however they are
+   * distributed.
+   */
+  void binsort (const IdxType global_data_size);
 
   /**
    * Communicates the bins from each processor to the
-   * appropriate processor.  By the time this function
-   * is finished, each processor will hold only its
-   * own bin(s).
+   * appropriate processor with a single all-to-all
+   * exchange.  By the time this function is finished,
+   * each processor will hold only its own bin(s).
    */
   void communicate_bins();
 
   /**
    * After all the bins have been communicated, we can
-   * sort our local bin.  This is nothing more than a
-   * call to std::sort
+   * sort our local bin.  This merges the sorted pieces
+   * received from each processor.
    */
   void sort_local_bin();
 
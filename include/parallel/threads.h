@@ -42,7 +42,8 @@ namespace Threads
 /**
  * A boolean which is true iff we are in a Threads:: function
  * It may be useful to assert(!Threads::in_threads) in any code
- * which is known to not be thread-safe.
+ * which is known to not be thread-safe.  A parallel_for() or
+ * parallel_reduce() started while it is true runs serially.
  */
 extern bool in_threads;
 
@@ -168,6 +169,20 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * NOTE: When using pthreads this constructor is MANDATORY!!!
+   *
+   * Copy constructor which sets the beginning and ending of the new
+   * range to be different from that of the one we're copying.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last):
+    _end(last),
+    _begin(first),
+    _grainsize(r._grainsize)
+  {}
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
@@ -220,7 +235,7 @@ public:
   /**
    * \returns The size of the range.
    */
-  int size () const { return (_end -_begin); }
+  std::size_t size () const { return (_end -_begin); }
 
   //------------------------------------------------------------------------
   // Methods that implement Range concept
@@ -72,6 +72,13 @@ template <typename Range, typename Body>
 inline
 void parallel_for (const Range & range, const Body & body)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (in_threads)
+    {
+      body(range);
+      return;
+    }
+
   BoolAcquire b(in_threads);
   body(range);
 }
@@ -86,6 +93,13 @@ template <typename Range, typename Body, typename Partitioner>
 inline
 void parallel_for (const Range & range, const Body & body, const Partitioner &)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (in_threads)
+    {
+      body(range);
+      return;
+    }
+
   BoolAcquire b(in_threads);
   body(range);
 }
@@ -100,6 +114,13 @@ template <typename Range, typename Body>
 inline
 void parallel_reduce (const Range & range, Body & body)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (in_threads)
+    {
+      body(range);
+      return;
+    }
+
   BoolAcquire b(in_threads);
   body(range);
 }
@@ -114,6 +135,13 @@ template <typename Range, typename Body, typename Partitioner>
 inline
 void parallel_reduce (const Range & range, Body & body, const Partitioner &)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (in_threads)
+    {
+      body(range);
+      return;
+    }
+
   BoolAcquire b(in_threads);
   body(range);
 }
@@ -217,25 +217,100 @@ unsigned int num_pthreads(Range & range)
   return min > 0 ? min : 1;
 }
 
+/**
+ * The threads which run the bodies of \p parallel_for() and
+ * \p parallel_reduce().  Worker threads are created the first time
+ * they are needed and then wait for the next loop, so that a loop
+ * only has to wake them up instead of creating and joining fresh
+ * threads.  When libMesh is built with OpenMP, the OpenMP thread
+ * team is used instead.
+ */
+class ThreadPool
+{
+public:
+  typedef void (*task_type)(void * data, unsigned int thread_id);
+
+  /**
+   * Calls \p task(data, i) concurrently for i = 0, ..., n_threads-1
+   * and returns once all of the calls have finished.  The calling
+   * thread takes part in the work.
+   */
+  static void run (task_type task, void * data, unsigned int n_threads);
+};
+
+/**
+ * Hands out consecutive chunks of a range to the threads of a
+ * parallel loop.  Each chunk is a fixed fraction of the iterations
+ * which have not been handed out yet, so that threads take large
+ * chunks first and small ones towards the end, and a thread whose
+ * iterations turn out to be cheap simply claims more of them.
+ *
+ * This takes the place of per-thread work-stealing queues: the
+ * loops libMesh threads run over flat ranges of known size, for
+ * which one shared counter is enough to balance the load.
+ */
+class ChunkScheduler
+{
+public:
+  ChunkScheduler (const std::size_t size,
+                  const unsigned int n_threads) :
+    _size(size),
+    _next(0),
+    _n_threads(n_threads)
+  {}
+
+  /**
+   * Claims the next chunk [begin, end) of the range.
+   * \returns false once the whole range has been handed out.
+   */
+  bool next_chunk (std::size_t & begin, std::size_t & end)
+  {
+    spin_mutex::scoped_lock lock(_mutex);
+
+    const std::size_t remaining = _size - _next;
+    if (!remaining)
+      return false;
+
+    const std::size_t chunk =
+      std::max(remaining / (2*_n_threads), std::size_t(1));
+
+    begin = _next;
+    _next += chunk;
+    end = _next;
+
+    return true;
+  }
+
+private:
+  const std::size_t _size;
+  std::size_t _next;
+  const std::size_t _n_threads;
+  spin_mutex _mutex;
+};
+
 template <typename Range, typename Body>
 class RangeBody
 {
 public:
-  Range * range;
-  Body * body;
+  const Range * range;
+  Body ** bodies;
+  ChunkScheduler * scheduler;
 };
 
 template <typename Range, typename Body>
-void * run_body(void * args)
+void run_body(void * args, unsigned int thread_id)
 {
   RangeBody<Range, Body> * range_body = (RangeBody<Range, Body> *)args;
 
-  Body & body = *range_body->body;
-  Range & range = *range_body->range;
+  Body & body = *range_body->bodies[thread_id];
+  const Range & range = *range_body->range;
 
-  body(range);
-
-  return libmesh_nullptr;
+  std::size_t begin, end;
+  while (range_body->scheduler->next_chunk(begin, end))
+    {
+      Range subrange(range, range.begin() + begin, range.begin() + end);
+      body(subrange);
+    }
 }
 
 /**
@@ -269,6 +344,13 @@ template <typename Range, typename Body>
 inline
 void parallel_for (const Range & range, const Body & body)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (Threads::in_threads)
+    {
+      body(range);
+      return;
+    }
+
   Threads::BoolAcquire b(Threads::in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
@@ -280,66 +362,17 @@ void parallel_for (const Range & range, const Body & body)
 
   unsigned int n_threads = num_pthreads(range);
 
-  std::vector<Range *> ranges(n_threads);
-  std::vector<RangeBody<const Range, const Body> > range_bodies(n_threads);
-  std::vector<pthread_t> threads(n_threads);
-
-  // Create the ranges for each thread
-  unsigned int range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      unsigned int this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
+  // Every thread uses the same body
+  std::vector<const Body *> bodies(n_threads, &body);
 
-      current_beginning = current_beginning + this_range_size;
-    }
-
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i];
-      range_bodies[i].body = &body;
-    }
-
-  // Create the threads.  It may seem redundant to wrap a pragma in
-  // #ifdefs... but GCC warns about an "unknown pragma" if it
-  // encounters this line of code when -fopenmp is not passed to the
-  // compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], libmesh_nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
+  ChunkScheduler scheduler(range.size(), n_threads);
 
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    pthread_join(threads[i], libmesh_nullptr);
-#endif
+  RangeBody<Range, const Body> range_body;
+  range_body.range = &range;
+  range_body.bodies = &bodies[0];
+  range_body.scheduler = &scheduler;
 
-  // Clean up
-  for (unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
+  ThreadPool::run(&run_body<Range, const Body>, &range_body, n_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
   if (libMesh::n_threads() > 1 && logging_was_enabled)
@@ -366,6 +399,13 @@ template <typename Range, typename Body>
 inline
 void parallel_reduce (const Range & range, Body & body)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (Threads::in_threads)
+    {
+      body(range);
+      return;
+    }
+
   Threads::BoolAcquire b(Threads::in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
@@ -377,68 +417,21 @@ void parallel_reduce (const Range & range, Body & body)
 
   unsigned int n_threads = num_pthreads(range);
 
-  std::vector<Range *> ranges(n_threads);
   std::vector<Body *> bodies(n_threads);
-  std::vector<RangeBody<Range, Body> > range_bodies(n_threads);
 
   // Create copies of the body for each thread
   bodies[0] = &body; // Use the original body for the first one
   for (unsigned int i=1; i<n_threads; i++)
     bodies[i] = new Body(body, Threads::split());
 
-  // Create the ranges for each thread
-  unsigned int range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
+  ChunkScheduler scheduler(range.size(), n_threads);
 
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      unsigned int this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
-
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i];
-      range_bodies[i].body = bodies[i];
-    }
+  RangeBody<Range, Body> range_body;
+  range_body.range = &range;
+  range_body.bodies = &bodies[0];
+  range_body.scheduler = &scheduler;
 
-  // Create the threads
-  std::vector<pthread_t> threads(n_threads);
-
-  // It may seem redundant to wrap a pragma in #ifdefs... but GCC
-  // warns about an "unknown pragma" if it encounters this line of
-  // code when -fopenmp is not passed to the compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], libmesh_nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-  for (unsigned int i=0; i<n_threads; i++)
-    pthread_join(threads[i], libmesh_nullptr);
-#endif
+  ThreadPool::run(&run_body<Range, Body>, &range_body, n_threads);
 
   // Join them all down to the original Body
   for (unsigned int i=n_threads-1; i != 0; i--)
@@ -447,8 +440,6 @@ void parallel_reduce (const Range & range, Body & body)
   // Clean up
   for (unsigned int i=1; i<n_threads; i++)
     delete bodies[i];
-  for (unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
   if (libMesh::n_threads() > 1 && logging_was_enabled)
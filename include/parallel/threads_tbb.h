@@ -86,6 +86,13 @@ template <typename Range, typename Body>
 inline
 void parallel_for (const Range & range, const Body & body)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (in_threads)
+    {
+      body(range);
+      return;
+    }
+
   BoolAcquire b(in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
@@ -117,6 +124,13 @@ template <typename Range, typename Body, typename Partitioner>
 inline
 void parallel_for (const Range & range, const Body & body, const Partitioner & partitioner)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (in_threads)
+    {
+      body(range);
+      return;
+    }
+
   BoolAcquire b(in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
@@ -148,6 +162,13 @@ template <typename Range, typename Body>
 inline
 void parallel_reduce (const Range & range, Body & body)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (in_threads)
+    {
+      body(range);
+      return;
+    }
+
   BoolAcquire b(in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
@@ -179,6 +200,13 @@ template <typename Range, typename Body, typename Partitioner>
 inline
 void parallel_reduce (const Range & range, Body & body, const Partitioner & partitioner)
 {
+  // Loops nested inside a threaded loop run on the calling thread
+  if (in_threads)
+    {
+      body(range);
+      return;
+    }
+
   BoolAcquire b(in_threads);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
@@ -30,6 +30,8 @@
 #include "libmesh/coupling_matrix.h"
 
 // C++ includes
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
@@ -150,6 +152,17 @@ public:
   Number evaluate_mesh_function(unsigned int var_number,
                                 Point p);
 
+  /**
+   * Evaluate the mesh function at each of \p points, for the
+   * corresponding variable in \p var_numbers, and store the results
+   * in \p values. All points are located locally first and the
+   * values are then shared with a single parallel exchange, which is
+   * much cheaper than calling evaluate_mesh_function() point by point.
+   */
+  void evaluate_mesh_function(const std::vector<unsigned int> & var_numbers,
+                              const std::vector<Point> & points,
+                              std::vector<Number> & values);
+
   /**
    * Set a point locator tolerance to be used in this class's MeshFunction, and
    * other operations that require a PointLocator.
@@ -282,6 +295,17 @@ protected:
                                        Real initial_greedy_error,
                                        int count) libmesh_override;
 
+  /**
+   * Gather the \p local_values found by
+   * evaluate_mesh_function_locally() on all processors in a single
+   * exchange and store them in \p values, which must already have
+   * the right size. An entry found on more than one processor takes
+   * the value from the highest processor id. Throws an error if any
+   * entry was not found on any processor.
+   */
+  void gather_mesh_function_values(std::vector<std::pair<unsigned int, Number> > & local_values,
+                                   std::vector<Number> & values);
+
   /**
    * Loop over the training set and compute the parametrized function for each
    * training index.
@@ -302,6 +326,16 @@ protected:
 
 private:
 
+  /**
+   * Evaluate the mesh function for variable \p var_number at \p p
+   * and, if \p p is in a local element, append the value tagged
+   * with \p index to \p local_values. No communication is done.
+   */
+  void evaluate_mesh_function_locally(unsigned int var_number,
+                                      const Point & p,
+                                      unsigned int index,
+                                      std::vector<std::pair<unsigned int, Number> > & local_values);
+
   /**
    * A mesh function to interpolate on the mesh.
    */
@@ -117,6 +117,17 @@ public:
    */
   virtual Real rb_solve(unsigned int N) libmesh_override;
 
+  /**
+   * Overridden to call rb_solve() for each parameter, since the EIM
+   * approximation is not an affine RB system.
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters> & mus,
+                              std::vector<std::vector<Number> > & outputs,
+                              std::vector<std::vector<Real> > & output_error_bounds,
+                              std::vector<Real> & error_bounds) libmesh_override
+  { sequential_rb_solve_batch(N, mus, outputs, output_error_bounds, error_bounds); }
+
   /**
    * Calculate the EIM approximation for the given
    * right-hand side vector \p EIM_rhs. Store the
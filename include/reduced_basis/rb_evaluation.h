@@ -109,6 +109,31 @@ public:
    */
   virtual Real rb_solve(unsigned int N);
 
+  /**
+   * Perform the online solve with the N RB basis functions for
+   * each of the parameters in \p mus. On return, \p outputs[i]
+   * and \p output_error_bounds[i] hold the RB outputs and output
+   * error bounds at \p mus[i], and \p error_bounds[i] holds the
+   * (absolute) error bound returned by rb_solve(). The error
+   * bounds are set to -1 if evaluate_RB_error_bound is false.
+   *
+   * The reduced basis data and the representor inner products are
+   * packed into contiguous arrays once per call and every theta
+   * function is evaluated exactly once per parameter, so this is
+   * much cheaper than calling rb_solve() in a loop. The member data
+   * RB_solution, RB_outputs and RB_output_error_bounds are not
+   * modified, and the current parameters are restored on return.
+   *
+   * Subclasses which override rb_solve() or
+   * compute_residual_dual_norm() should override this as well, e.g.
+   * with sequential_rb_solve_batch().
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters> & mus,
+                              std::vector<std::vector<Number> > & outputs,
+                              std::vector<std::vector<Real> > & output_error_bounds,
+                              std::vector<Real> & error_bounds);
+
   /**
    * \returns A scaling factor that we can use to provide a consistent
    * scaling of the RB error bound across different parameter values.
@@ -337,6 +362,17 @@ protected:
    */
   void assert_file_exists(const std::string & file_name);
 
+  /**
+   * Implements rb_solve_batch() by calling set_parameters() and
+   * rb_solve() for each parameter in turn, and copying RB_outputs
+   * and RB_output_error_bounds.
+   */
+  void sequential_rb_solve_batch(unsigned int N,
+                                 const std::vector<RBParameters> & mus,
+                                 std::vector<std::vector<Number> > & outputs,
+                                 std::vector<std::vector<Real> > & output_error_bounds,
+                                 std::vector<Real> & error_bounds);
+
 private:
 
   /**
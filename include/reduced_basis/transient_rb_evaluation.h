@@ -90,6 +90,17 @@ public:
    */
   virtual Real rb_solve(unsigned int N) libmesh_override;
 
+  /**
+   * Overridden to perform a time-dependent solve for each
+   * parameter. The outputs and output error bounds are those at the
+   * final time level.
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters> & mus,
+                              std::vector<std::vector<Number> > & outputs,
+                              std::vector<std::vector<Real> > & output_error_bounds,
+                              std::vector<Real> & error_bounds) libmesh_override;
+
   /**
    * If a solve has already been performed, then we cached some data
    * and we can perform a new solve much more rapidly
@@ -0,0 +1,249 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_KRYLOV_LINEAR_SOLVER_H
+#define LIBMESH_KRYLOV_LINEAR_SOLVER_H
+
+// Local includes
+#include "libmesh/linear_solver.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class provides libMesh's own Krylov solvers, which need no
+ * external solver package.  They are written in terms of the
+ * \p NumericVector interface and are meant to be used with a
+ * \p DistributedSparseMatrix and \p DistributedVector, or with a
+ * \p ShellMatrix.
+ *
+ * The supported solvers are \p CG, \p GMRES (the default) and
+ * \p BICGSTAB.  GMRES is right-preconditioned and restarted every 30
+ * iterations, unless the attached \p SolverConfiguration has an int
+ * parameter called "gmres_restart".
+ *
+ * The supported preconditioners are \p IDENTITY_PRECOND,
+ * \p JACOBI_PRECOND and \p ILU_PRECOND.  The latter is an ILU(0)
+ * factorization of the diagonal block of the local rows, i.e. a
+ * block Jacobi preconditioner in parallel, so \p BLOCK_JACOBI_PRECOND
+ * means the same.  A user-supplied \p Preconditioner may be attached
+ * instead.
+ *
+ * Iterations stop once the residual norm has been reduced by the
+ * factor \p tol relative to the norm of the right hand side.
+ *
+ * \brief Native Krylov linear solvers.
+ */
+template <typename T>
+class KrylovLinearSolver : public LinearSolver<T>
+{
+public:
+  /**
+   *  Constructor.
+   */
+  KrylovLinearSolver (const libMesh::Parallel::Communicator & comm_in
+                      LIBMESH_CAN_DEFAULT_TO_COMMWORLD);
+
+  /**
+   * Destructor.
+   */
+  ~KrylovLinearSolver ();
+
+  /**
+   * Release all memory and clear data structures.
+   */
+  virtual void clear () libmesh_override;
+
+  /**
+   * Initialize data structures if not done so already.
+   */
+  virtual void init (const char * name=libmesh_nullptr) libmesh_override;
+
+  /**
+   * Call the Krylov solver.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) libmesh_override;
+
+  /**
+   * Call the Krylov solver to solve A^T x = b.
+   */
+  virtual std::pair<unsigned int, Real>
+  adjoint_solve (SparseMatrix<T> & matrix,
+                 NumericVector<T> & solution,
+                 NumericVector<T> & rhs,
+                 const double tol,
+                 const unsigned int m_its) libmesh_override;
+
+  /**
+   * Call the Krylov solver, building the preconditioner from \p pc.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         SparseMatrix<T> & pc,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) libmesh_override;
+
+  /**
+   * This function solves a system whose matrix is a shell matrix.
+   * Only Jacobi preconditioning, based on the diagonal of the shell
+   * matrix, is available in this case.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) libmesh_override;
+
+  /**
+   * This function solves a system whose matrix is a shell matrix, but
+   * a sparse matrix is used as preconditioning matrix, this allowing
+   * other preconditioners than JACOBI.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         const SparseMatrix<T> & precond_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) libmesh_override;
+
+  /**
+   * \returns The solver's convergence flag
+   */
+  virtual LinearConvergenceReason get_converged_reason() const libmesh_override;
+
+private:
+
+  /**
+   * Sets up the preconditioner and runs the selected solver, with
+   * the operator given either by \p matrix or by \p shell_matrix.
+   */
+  std::pair<unsigned int, Real>
+  solve_system (const SparseMatrix<T> * matrix,
+                const ShellMatrix<T> * shell_matrix,
+                const SparseMatrix<T> * precond_matrix,
+                NumericVector<T> & solution,
+                NumericVector<T> & rhs,
+                const double tol,
+                const unsigned int m_its);
+
+  /**
+   * The preconditioned conjugate gradient method.
+   */
+  std::pair<unsigned int, Real>
+  cg (NumericVector<T> & x, const NumericVector<T> & b,
+      const double tol, const unsigned int m_its);
+
+  /**
+   * The restarted, right-preconditioned GMRES method.
+   */
+  std::pair<unsigned int, Real>
+  gmres (NumericVector<T> & x, const NumericVector<T> & b,
+         const double tol, const unsigned int m_its);
+
+  /**
+   * The right-preconditioned BiCGStab method.
+   */
+  std::pair<unsigned int, Real>
+  bicgstab (NumericVector<T> & x, const NumericVector<T> & b,
+            const double tol, const unsigned int m_its);
+
+  /**
+   * Computes \p dest = A \p arg.
+   */
+  void apply_operator (NumericVector<T> & dest,
+                       const NumericVector<T> & arg) const;
+
+  /**
+   * Builds the Jacobi or ILU(0) preconditioner from \p precond_matrix
+   * or, if that is NULL, from the operator.
+   */
+  void setup_preconditioner (const SparseMatrix<T> * precond_matrix,
+                             const NumericVector<T> & example);
+
+  /**
+   * Computes \p z = M^{-1} \p r.
+   */
+  void apply_preconditioner (const NumericVector<T> & r,
+                             NumericVector<T> & z);
+
+  /**
+   * The operator of the current solve.  Only one of them is set.
+   */
+  const SparseMatrix<T> * _matrix;
+  const ShellMatrix<T> * _shell_matrix;
+
+  /**
+   * The inverse of the diagonal, for Jacobi preconditioning.
+   */
+  UniquePtr<NumericVector<T> > _inverse_diagonal;
+
+  /**
+   * The ILU(0) factors of the local diagonal block in CSR format,
+   * with local column indices and the position of each diagonal
+   * entry.  L has a unit diagonal and is stored below it.
+   */
+  std::vector<std::size_t> _ilu_offsets;
+  std::vector<numeric_index_type> _ilu_cols;
+  std::vector<T> _ilu_values;
+  std::vector<std::size_t> _ilu_diagonal;
+
+  /**
+   * The global indices of the local entries of the vectors, and
+   * workspace for the ILU(0) triangular solves.
+   */
+  std::vector<numeric_index_type> _local_indices;
+  std::vector<T> _ilu_work;
+
+  /**
+   * True if the preconditioner has been set up, so that it can be
+   * reused if requested.
+   */
+  bool _preconditioner_is_setup;
+
+  /**
+   * Store the result of the last solve.
+   */
+  LinearConvergenceReason _converged_reason;
+};
+
+
+
+template <typename T>
+inline
+KrylovLinearSolver<T>::~KrylovLinearSolver ()
+{
+  this->clear ();
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_KRYLOV_LINEAR_SOLVER_H
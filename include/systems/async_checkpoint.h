@@ -0,0 +1,167 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ASYNC_CHECKPOINT_H
+#define LIBMESH_ASYNC_CHECKPOINT_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/enum_xdr_mode.h"
+#include "libmesh/equation_systems.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Writes the systems of an \p EquationSystems object in the
+ * background, in the format EquationSystems::write() uses for
+ * parallel files.
+ *
+ * write() writes the small header file and copies the local entries
+ * of the vectors to be written, then returns while a separate thread
+ * writes the copies to each processor's data file.  The systems may
+ * be modified as soon as write() returns.  wait() completes the
+ * checkpoint, and must be called before the AsyncCheckpoint is
+ * destroyed.
+ *
+ * The header names the data files, which alternate between two
+ * names so that those of the checkpoint in place are never
+ * overwritten.  The header itself is first written under a temporary
+ * name, and renaming it once every processor has written its data
+ * completes the checkpoint; one that is interrupted at any point
+ * leaves the previous checkpoint intact.  Like any parallel files
+ * the checkpoint can only be read back on the same number of
+ * processors with the same partitioning, using
+ * EquationSystems::read() with \p partition_agnostic set to false.
+ *
+ * \brief Writes EquationSystems checkpoints in the background.
+ */
+class AsyncCheckpoint : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  Checkpoints of \p es will be written.
+   */
+  explicit
+  AsyncCheckpoint (const EquationSystems & es);
+
+  /**
+   * Destructor.  A pending checkpoint must be completed by wait()
+   * first; otherwise it is discarded with a warning, and its
+   * temporary files are removed.
+   */
+  ~AsyncCheckpoint ();
+
+  /**
+   * Starts writing a checkpoint to \p name, which is read back by
+   * EquationSystems::read().  Any pending checkpoint is completed
+   * first.  \p write_flags are as for EquationSystems::write(); they
+   * always include \p WRITE_PARALLEL_FILES.
+   *
+   * This function must be called on all processors at once.
+   */
+  void write (const std::string & name,
+              const XdrMODE mode,
+              const unsigned int write_flags =
+              (EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA));
+
+  /**
+   * \returns \p true if a checkpoint has been started and not yet
+   * completed by wait().
+   */
+  bool pending () const { return !_name.empty(); }
+
+  /**
+   * Blocks until the pending checkpoint, if any, has been written
+   * on every processor, then moves its header to its final name and
+   * removes the data files of the checkpoint it replaces.  Throws an
+   * error on every processor if any of them failed to write its data,
+   * or if the header could not be moved.
+   *
+   * This function must be called on all processors at once.
+   */
+  void wait ();
+
+private:
+
+  /**
+   * \returns The name the parallel data files of the existing header
+   * \p name, written in \p mode, are named after, or an empty string
+   * if there is no such header or it was not written by an
+   * AsyncCheckpoint.
+   */
+  static std::string committed_data_name (const std::string & name,
+                                          const XdrMODE mode);
+
+  /**
+   * Removes the files of the pending checkpoint which this processor
+   * wrote.
+   */
+  void remove_new_files () const;
+
+  /**
+   * The systems to checkpoint.
+   */
+  const EquationSystems & _es;
+
+  /**
+   * The name of the pending checkpoint, if any.
+   */
+  std::string _name;
+
+  /**
+   * The names the data files of the pending checkpoint, and those of
+   * the checkpoint it replaces, if any, are named after.
+   */
+  std::string _data_name, _previous_data_name;
+
+  /**
+   * Whether the pending checkpoint has data files.
+   */
+  bool _write_data;
+
+  /**
+   * The copied vectors of all the systems written, with the comments
+   * they are written with.
+   */
+  std::vector<std::pair<std::string, std::vector<Number> > > _data;
+
+  /**
+   * Set by the writing thread if the data could not be written.
+   */
+  bool _failed;
+
+  /**
+   * The thread writing the data files of the pending checkpoint.
+   */
+  UniquePtr<Threads::Thread> _writer;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ASYNC_CHECKPOINT_H
@@ -298,6 +298,31 @@ public:
   UniquePtr<NumericVector<Number> >
   build_parallel_solution_vector(const std::set<std::string> * system_names=libmesh_nullptr) const;
 
+  /**
+   * A streaming counterpart of build_solution_vector() for serial
+   * output formats.  Fills \p soln_block on processor \p proc_id
+   * with the node-major solution values of the nodes with ids in
+   * [\p first_node, \p last_node), taken from a vector built by
+   * build_parallel_solution_vector().  The vector is left empty on
+   * all other processors.
+   *
+   * Looping over consecutive blocks of nodes lets a writer emit the
+   * nodal solution incrementally, with the memory needed on
+   * \p proc_id bounded by the block size rather than by the problem
+   * size.  Only the processors holding part of a block send it, to
+   * \p proc_id alone.  They learn who holds what from
+   * \p local_index_ends, which is filled in on the first call and
+   * should be passed back unchanged for every later block of the
+   * same vector.  This function must be run on all processors at
+   * once.
+   */
+  void localize_solution_block (const NumericVector<Number> & parallel_soln,
+                                const dof_id_type first_node,
+                                const dof_id_type last_node,
+                                std::vector<Number> & soln_block,
+                                std::vector<numeric_index_type> & local_index_ends,
+                                const processor_id_type proc_id = 0) const;
+
   /**
    * Retrieve the solution data for CONSTANT MONOMIALs.  If \p names
    * is populated, only the variables corresponding to those names will
@@ -494,6 +519,38 @@ protected:
 
 private:
 
+  /**
+   * AsyncCheckpoint writes the data of our systems to the same
+   * files write() does.
+   */
+  friend class AsyncCheckpoint;
+
+  /**
+   * \returns The name of the file holding the data of processor
+   * \p processor_id when \p name is written with parallel files.
+   */
+  static std::string _local_file_name (const unsigned int processor_id,
+                                       const std::string & name);
+
+  /**
+   * \returns The name parallel data files are named after for the
+   * header file \p name with version string \p version: \p name
+   * itself, unless the header names other files next to it.
+   */
+  static std::string _data_file_name (const std::string & name,
+                                      const std::string & version);
+
+  /**
+   * Implements write().  If \p data_name is not empty, the header
+   * refers to parallel data files named after \p data_name instead
+   * of \p name, which then must be in the same directory as \p name.
+   */
+  void _write_impl (const std::string & name,
+                    const XdrMODE mode,
+                    const unsigned int write_flags,
+                    bool partition_agnostic,
+                    const std::string & data_name) const;
+
   /**
    * Actual read implementation.  This can be called repeatedly
    * inside a try-catch block in an attempt to read broken files.
@@ -49,6 +49,7 @@ class EquationSystems;
 class MeshBase;
 class Xdr;
 class DofMap;
+class DofObject;
 template <typename Output> class FunctionBase;
 class Parameters;
 class ParameterVector;
@@ -1328,6 +1329,17 @@ public:
   void write_parallel_data (Xdr & io,
                             const bool write_additional_data) const;
 
+  /**
+   * Copies the local entries of the solution vector, and of the
+   * additional vectors if \p write_additional_data is true, into
+   * \p data, in the order in which write_parallel_data() writes
+   * them and paired with the comment each is written with.  Writing
+   * the copies later produces the same file, even if the vectors have
+   * changed in the meantime.
+   */
+  void copy_parallel_data (std::vector<std::pair<std::string, std::vector<Number> > > & data,
+                           const bool write_additional_data) const;
+
   /**
    * \returns A string containing information about the
    * system.
@@ -1778,6 +1790,25 @@ private:
                                                     Xdr & io,
                                                     const unsigned int var_to_write=libMesh::invalid_uint) const;
 
+  /**
+   * Fills \p ordered_nodes and \p ordered_elements with the local
+   * nodes and elements, sorted by id, in the order parallel files
+   * store their values.
+   */
+  void local_dof_objects_by_id (std::vector<const DofObject *> & ordered_nodes,
+                                std::vector<const DofObject *> & ordered_elements) const;
+
+  /**
+   * Fills \p io_buffer with the local entries of \p vec in the order
+   * parallel files store them: node and then element values for each
+   * non-SCALAR variable, followed by the SCALAR values on the last
+   * processor.
+   */
+  void local_data_by_id (const NumericVector<Number> & vec,
+                         const std::vector<const DofObject *> & ordered_nodes,
+                         const std::vector<const DofObject *> & ordered_elements,
+                         std::vector<Number> & io_buffer) const;
+
   /**
    * Writes the SCALAR dofs associated with var to the stream \p io.
    *
@@ -10,7 +10,9 @@
 #include <libmesh/fe_interface.h>
 #include <libmesh/mesh.h>
 #include <libmesh/mesh_generation.h>
+#include <libmesh/node.h>
 #include <libmesh/numeric_vector.h>
+#include <libmesh/quadrature_gauss.h>
 #include <libmesh/system.h>
 
 // Ignore unused parameter warnings coming from cppunit headers
@@ -24,7 +26,8 @@
 #define FETEST                                  \
   CPPUNIT_TEST( testU );                        \
   CPPUNIT_TEST( testGradU );                    \
-  CPPUNIT_TEST( testGradUComp );
+  CPPUNIT_TEST( testGradUComp );               \
+  CPPUNIT_TEST( testInverseMap );
 
 using namespace libMesh;
 
@@ -264,6 +267,66 @@ public:
 #endif
   }
 
+  // Maps reference points to \p elem and back, one at a time and all
+  // at once.
+  void checkInverseMap(const Elem * elem)
+  {
+    QGauss qrule (_dim, FIFTH);
+    qrule.init(elem->type());
+
+    const std::vector<Point> & ref_points = qrule.get_points();
+
+    std::vector<Point> physical_points(ref_points.size());
+    for (std::size_t qp = 0; qp != ref_points.size(); ++qp)
+      physical_points[qp] =
+        FEInterface::map(_dim, _fe->get_fe_type(), elem, ref_points[qp]);
+
+    std::vector<Point> inverse_points;
+    FEInterface::inverse_map(_dim, _fe->get_fe_type(), elem,
+                             physical_points, inverse_points,
+                             TOLERANCE*TOLERANCE);
+
+    CPPUNIT_ASSERT_EQUAL(ref_points.size(), inverse_points.size());
+
+    for (std::size_t qp = 0; qp != ref_points.size(); ++qp)
+      {
+        const Point p =
+          FEInterface::inverse_map(_dim, _fe->get_fe_type(), elem,
+                                   physical_points[qp], TOLERANCE*TOLERANCE);
+
+        for (unsigned int d = 0; d != _dim; ++d)
+          {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(ref_points[qp](d), p(d), TOLERANCE);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(ref_points[qp](d), inverse_points[qp](d), TOLERANCE);
+          }
+      }
+  }
+
+  void testInverseMap()
+  {
+    // Handle the "more processors than elements" case
+    if (!_elem)
+      return;
+
+    // Our mesh element has an affine map
+    checkInverseMap(_elem);
+
+    // A distorted copy of it does not
+    UniquePtr<Elem> distorted = Elem::build(_elem->type());
+    for (unsigned int n = 0; n != _elem->n_nodes(); ++n)
+      {
+        Point p = _elem->point(n);
+        for (unsigned int d = 0; d != _dim; ++d)
+          p(d) += 0.01 * Real((3*n + d) % 5) / 5;
+        distorted->set_node(n) = Node::build(p, n).release();
+      }
+
+    checkInverseMap(distorted.get());
+
+    for (unsigned int n = 0; n != distorted->n_nodes(); ++n)
+      delete distorted->node_ptr(n);
+  }
+
 };
 
 // THE CPPUNIT_TEST_SUITE_END macro expands to code that involves